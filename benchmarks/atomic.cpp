@@ -0,0 +1,62 @@
+#include <nira/atomic.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace {
+constexpr int iterations = 100'000;
+
+template <typename Function>
+void run_threads(const unsigned thread_count, const Function& function)
+{
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < thread_count; ++i)
+        threads.emplace_back(function);
+    for (auto& thread : threads)
+        thread.join();
+}
+}
+
+TEST_CASE("Concurrent FixedPoint accumulation")
+{
+    using Fixed = nira::FixedPoint<8, std::int64_t>;
+    const auto thread_count = std::max(std::thread::hardware_concurrency(), 2u);
+    const Fixed delta(0, 1);
+
+    BENCHMARK("std::atomic<FixedPoint> compare_exchange_weak")
+    {
+        std::atomic<Fixed> total;
+        run_threads(thread_count, [&] {
+            for (int i = 0; i < iterations; ++i) {
+                auto expected = total.load(std::memory_order_relaxed);
+                while (!total.compare_exchange_weak(expected, expected + delta, std::memory_order_relaxed)) { }
+            }
+        });
+        return total.load();
+    };
+
+    BENCHMARK("AtomicFixedPoint::fetch_add")
+    {
+        nira::AtomicFixedPoint<8, std::int64_t> total;
+        run_threads(thread_count, [&] {
+            for (int i = 0; i < iterations; ++i)
+                total.fetch_add(delta, std::memory_order_relaxed);
+        });
+        return total.load();
+    };
+
+    BENCHMARK("ShardedAccumulator::operator+=")
+    {
+        nira::ShardedAccumulator<8, std::int64_t> total;
+        run_threads(thread_count, [&] {
+            for (int i = 0; i < iterations; ++i)
+                total += delta;
+        });
+        return total.load();
+    };
+}
@@ -0,0 +1,119 @@
+#include <nira/decimal.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+constexpr std::size_t count = 1'000;
+
+// Products of values below 30 stay below 900 so the raw FixedPoint<8, std::int64_t> product cannot overflow
+constexpr double max_value = 30.0;
+
+template <typename T>
+std::vector<T> make_values(const unsigned seed)
+{
+    std::mt19937 engine(seed);
+    std::uniform_real_distribution distribution(0.01, max_value);
+    std::vector<T> values;
+    values.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        values.push_back(T(nira::FixedPoint<8, std::int64_t>(distribution(engine))));
+    return values;
+}
+}
+
+TEST_CASE("Decimal versus FixedPoint")
+{
+    using Fixed = nira::FixedPoint<8, std::int64_t>;
+    using Decimal = nira::Decimal<std::int64_t>;
+    const auto fixed_lhs = make_values<Fixed>(1);
+    const auto fixed_rhs = make_values<Fixed>(2);
+    const auto decimal_lhs = make_values<Decimal>(1);
+    const auto decimal_rhs = make_values<Decimal>(2);
+
+    BENCHMARK("FixedPoint sum")
+    {
+        Fixed total;
+        for (std::size_t i = 0; i < count; ++i)
+            total += fixed_lhs[i] + fixed_rhs[i];
+        return total;
+    };
+
+    BENCHMARK("Decimal sum")
+    {
+        Decimal total;
+        for (std::size_t i = 0; i < count; ++i)
+            total += decimal_lhs[i] + decimal_rhs[i];
+        return total;
+    };
+
+    BENCHMARK("FixedPoint product")
+    {
+        Fixed total;
+        for (std::size_t i = 0; i < count; ++i)
+            total += fixed_lhs[i] * fixed_rhs[i];
+        return total;
+    };
+
+    BENCHMARK("Decimal product")
+    {
+        Decimal total;
+        for (std::size_t i = 0; i < count; ++i)
+            total += decimal_lhs[i] * decimal_rhs[i];
+        return total;
+    };
+
+    BENCHMARK("FixedPoint comparison")
+    {
+        std::size_t less = 0;
+        for (std::size_t i = 0; i < count; ++i)
+            less += fixed_lhs[i] < fixed_rhs[i];
+        return less;
+    };
+
+    BENCHMARK("Decimal comparison")
+    {
+        std::size_t less = 0;
+        for (std::size_t i = 0; i < count; ++i)
+            less += decimal_lhs[i] < decimal_rhs[i];
+        return less;
+    };
+}
+
+TEST_CASE("Decimal with mixed exponents")
+{
+    // Notionals around 1e12 mixed with quantities around 1e-8 span more digits than a
+    // FixedPoint<8, std::int64_t> can hold, so only Decimal is timed
+    using Decimal = nira::Decimal<std::int64_t>;
+    std::mt19937 engine(3);
+    std::uniform_int_distribution<std::int64_t> coefficients(1, 999'999);
+    std::uniform_int_distribution exponents(-8, 12);
+    std::vector<Decimal> lhs;
+    std::vector<Decimal> rhs;
+    lhs.reserve(count);
+    rhs.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        lhs.emplace_back(coefficients(engine), exponents(engine));
+        rhs.emplace_back(coefficients(engine), exponents(engine));
+    }
+
+    BENCHMARK("Decimal sum, mixed exponents")
+    {
+        Decimal total;
+        for (std::size_t i = 0; i < count; ++i)
+            total += lhs[i] + rhs[i];
+        return total;
+    };
+
+    BENCHMARK("Decimal comparison, mixed exponents")
+    {
+        std::size_t less = 0;
+        for (std::size_t i = 0; i < count; ++i)
+            less += lhs[i] < rhs[i];
+        return less;
+    };
+}
@@ -0,0 +1,86 @@
+#include <nira/fixed_point.hpp>
+#include <nira/rational.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+constexpr std::size_t count = 1'000;
+
+std::vector<std::int64_t> make_integers(const unsigned seed, const std::int64_t min, const std::int64_t max)
+{
+    std::mt19937 engine(seed);
+    std::uniform_int_distribution distribution(min, max);
+    std::vector<std::int64_t> values;
+    values.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        values.push_back(distribution(engine));
+    return values;
+}
+}
+
+TEST_CASE("Price times quantity")
+{
+    using Fixed = nira::FixedPoint<4, std::int64_t>;
+    using Rational = nira::Rational<std::int64_t>;
+    const auto raw_prices = make_integers(1, 1, 10'000'000);
+    const auto quantities = make_integers(2, 1, 1'000);
+    std::vector<Fixed> prices;
+    std::vector<Rational> ratios;
+    for (std::size_t i = 0; i < count; ++i) {
+        prices.push_back(Fixed::from_raw(raw_prices[i]));
+        ratios.emplace_back(raw_prices[i], 10'000);
+    }
+
+    BENCHMARK("FixedPoint * FixedPoint(quantity)")
+    {
+        Fixed total;
+        for (std::size_t i = 0; i < count; ++i)
+            total += prices[i] * Fixed(quantities[i]);
+        return total;
+    };
+
+    BENCHMARK("FixedPoint * quantity")
+    {
+        Fixed total;
+        for (std::size_t i = 0; i < count; ++i)
+            total += prices[i] * quantities[i];
+        return total;
+    };
+
+    BENCHMARK("FixedPoint * FixedPoint(Rational)")
+    {
+        Fixed total;
+        for (std::size_t i = 0; i < count; ++i)
+            total += prices[i] * (Fixed(ratios[i].numerator()) / Fixed(ratios[i].denominator()));
+        return total;
+    };
+
+    BENCHMARK("FixedPoint * Rational")
+    {
+        Fixed total;
+        for (std::size_t i = 0; i < count; ++i)
+            total += prices[i] * ratios[i];
+        return total;
+    };
+
+    std::vector<Rational> results(count);
+
+    BENCHMARK("Rational * Rational(quantity)")
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            results[i] = ratios[i] * Rational(quantities[i]);
+        return results.back();
+    };
+
+    BENCHMARK("Rational * quantity")
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            results[i] = ratios[i] * quantities[i];
+        return results.back();
+    };
+}
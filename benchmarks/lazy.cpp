@@ -0,0 +1,110 @@
+#include <nira/lazy.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+constexpr std::size_t count = 1'000;
+
+template <typename T, typename Distribution>
+std::vector<T> make_values(Distribution distribution)
+{
+    std::mt19937 engine(42);
+    std::vector<T> values;
+    values.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        values.push_back(T(distribution(engine)));
+    return values;
+}
+}
+
+TEST_CASE("FixedPoint formulas")
+{
+    using Fixed = nira::FixedPoint<4, std::int64_t>;
+    const auto a = make_values<Fixed>(std::uniform_real_distribution(1.0, 1'000.0));
+    const auto b = make_values<Fixed>(std::uniform_real_distribution(1.0, 1'000.0));
+    const auto c = make_values<Fixed>(std::uniform_real_distribution(1.0, 1'000.0));
+    const auto d = make_values<Fixed>(std::uniform_real_distribution(1.0, 1'000.0));
+
+    BENCHMARK("Eager a * b / c")
+    {
+        Fixed total;
+        for (std::size_t i = 0; i < count; ++i)
+            total += a[i] * b[i] / c[i];
+        return total;
+    };
+
+    BENCHMARK("Lazy a * b / c")
+    {
+        Fixed total;
+        for (std::size_t i = 0; i < count; ++i)
+            total += nira::lazy(a[i]) * b[i] / c[i];
+        return total;
+    };
+
+    BENCHMARK("Eager a * b + c * d - a / d")
+    {
+        Fixed total;
+        for (std::size_t i = 0; i < count; ++i)
+            total += a[i] * b[i] + c[i] * d[i] - a[i] / d[i];
+        return total;
+    };
+
+    BENCHMARK("Lazy a * b + c * d - a / d")
+    {
+        Fixed total;
+        for (std::size_t i = 0; i < count; ++i)
+            total += nira::lazy(a[i]) * b[i] + nira::lazy(c[i]) * d[i] - nira::lazy(a[i]) / d[i];
+        return total;
+    };
+}
+
+TEST_CASE("Rational formulas")
+{
+    using Rational = nira::Rational<std::int32_t>;
+    const auto make_rationals = [](const unsigned seed) {
+        std::mt19937 engine(seed);
+        std::uniform_int_distribution distribution(1, 100);
+        std::vector<Rational> values;
+        values.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+            values.emplace_back(distribution(engine), distribution(engine));
+        return values;
+    };
+    const auto a = make_rationals(1);
+    const auto b = make_rationals(2);
+    const auto c = make_rationals(3);
+    std::vector<Rational> results(count);
+
+    BENCHMARK("Eager a * b / c")
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            results[i] = a[i] * b[i] / c[i];
+        return results.back();
+    };
+
+    BENCHMARK("Lazy a * b / c")
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            results[i] = nira::lazy(a[i]) * b[i] / c[i];
+        return results.back();
+    };
+
+    BENCHMARK("Eager a * b + c - a / b")
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            results[i] = a[i] * b[i] + c[i] - a[i] / b[i];
+        return results.back();
+    };
+
+    BENCHMARK("Lazy a * b + c - a / b")
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            results[i] = nira::lazy(a[i]) * b[i] + c[i] - nira::lazy(a[i]) / b[i];
+        return results.back();
+    };
+}
@@ -0,0 +1,79 @@
+#include <nira/window.hpp>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+// Each run processes this many ticks so a run must finish within 100ms to sustain a million ticks per second
+constexpr std::size_t tick_count = 100'000;
+constexpr std::size_t window_size = 100;
+
+using Price = nira::FixedPoint<4, std::int64_t>;
+using Volume = nira::FixedPoint<2, std::int64_t>;
+using Vwap = nira::RollingVwap<4, 2, std::int64_t>;
+
+std::vector<Vwap::Trade> make_trades()
+{
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<std::int64_t> prices(990'000, 1'010'000);
+    std::uniform_int_distribution<std::int64_t> volumes(1, 100'000);
+    std::vector<Vwap::Trade> trades;
+    trades.reserve(tick_count);
+    for (std::size_t i = 0; i < tick_count; ++i)
+        trades.push_back({ Price::from_raw(prices(engine)), Volume::from_raw(volumes(engine)) });
+    return trades;
+}
+}
+
+TEST_CASE("Sliding window VWAP")
+{
+    const auto trades = make_trades();
+
+    BENCHMARK("Recompute over the whole window")
+    {
+        Price total;
+        for (std::size_t i = window_size; i < tick_count; ++i) {
+            Price notional;
+            Volume volume;
+            for (std::size_t j = i - window_size; j < i; ++j) {
+                notional += Price(trades[j].price * trades[j].volume);
+                volume += trades[j].volume;
+            }
+            total += Price(nira::lazy(notional) / volume);
+        }
+        return total;
+    };
+
+    BENCHMARK("SlidingWindow<RollingVwap>")
+    {
+        Price total;
+        nira::SlidingWindow<Vwap> window(window_size);
+        for (std::size_t i = 0; i < tick_count; ++i) {
+            window.push(trades[i]);
+            if (window.size() == window_size)
+                total += Price(window.aggregate().vwap());
+        }
+        return total;
+    };
+}
+
+TEST_CASE("Sliding window variance")
+{
+    const auto trades = make_trades();
+
+    BENCHMARK("SlidingWindow<RollingStatistics>")
+    {
+        Price total;
+        nira::SlidingWindow<nira::RollingStatistics<4, std::int64_t>> window(window_size);
+        for (std::size_t i = 0; i < tick_count; ++i) {
+            window.push(trades[i].price);
+            if (window.size() == window_size)
+                total += Price(window.aggregate().variance());
+        }
+        return total;
+    };
+}
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <nira/fixed_point.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+namespace nira {
+namespace detail {
+    // Assumed cache line size. Avoids std::hardware_destructive_interference_size which is not ABI stable.
+    inline constexpr std::size_t cache_line_size = 64;
+
+    // Each thread is assigned a distinct index the first time it asks for one
+    [[nodiscard]] inline std::size_t thread_index() noexcept
+    {
+        static std::atomic<std::size_t> next { 0 };
+        thread_local const auto index = next.fetch_add(1, std::memory_order_relaxed);
+        return index;
+    }
+}
+
+// Lock-free FixedPoint which exposes the fetch_add and fetch_sub operations of the underlying integer
+template <std::uint8_t scale, std::signed_integral IntType = int>
+class AtomicFixedPoint {
+public:
+    using value_type = FixedPoint<scale, IntType>;
+
+    static constexpr bool is_always_lock_free = std::atomic<IntType>::is_always_lock_free;
+
+    constexpr AtomicFixedPoint() noexcept = default;
+
+    constexpr AtomicFixedPoint(const value_type value) noexcept
+        : m_value(value.raw())
+    {
+    }
+
+    AtomicFixedPoint(const AtomicFixedPoint&) = delete;
+    AtomicFixedPoint& operator=(const AtomicFixedPoint&) = delete;
+
+    value_type operator=(const value_type value) noexcept
+    {
+        store(value);
+        return value;
+    }
+
+    [[nodiscard]] bool is_lock_free() const noexcept
+    {
+        return m_value.is_lock_free();
+    }
+
+    void store(const value_type value, const std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        m_value.store(value.raw(), order);
+    }
+
+    [[nodiscard]] value_type load(const std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return value_type::from_raw(m_value.load(order));
+    }
+
+    operator value_type() const noexcept
+    {
+        return load();
+    }
+
+    value_type exchange(const value_type value, const std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return value_type::from_raw(m_value.exchange(value.raw(), order));
+    }
+
+    bool compare_exchange_weak(value_type& expected,
+                               const value_type desired,
+                               const std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        auto raw = expected.raw();
+        const auto exchanged = m_value.compare_exchange_weak(raw, desired.raw(), order);
+        expected = value_type::from_raw(raw);
+        return exchanged;
+    }
+
+    bool compare_exchange_strong(value_type& expected,
+                                 const value_type desired,
+                                 const std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        auto raw = expected.raw();
+        const auto exchanged = m_value.compare_exchange_strong(raw, desired.raw(), order);
+        expected = value_type::from_raw(raw);
+        return exchanged;
+    }
+
+    value_type fetch_add(const value_type value, const std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return value_type::from_raw(m_value.fetch_add(value.raw(), order));
+    }
+
+    value_type fetch_sub(const value_type value, const std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return value_type::from_raw(m_value.fetch_sub(value.raw(), order));
+    }
+
+    value_type operator+=(const value_type value) noexcept
+    {
+        return fetch_add(value) + value;
+    }
+
+    value_type operator-=(const value_type value) noexcept
+    {
+        return fetch_sub(value) - value;
+    }
+
+private:
+    std::atomic<IntType> m_value { 0 };
+};
+
+// Sum which spreads concurrent writes across cache line sized shards so threads rarely contend.
+// Reading adds up every shard so it is exact but more expensive than a write.
+template <std::uint8_t scale, std::signed_integral IntType = int>
+class ShardedAccumulator {
+public:
+    using value_type = FixedPoint<scale, IntType>;
+
+    // The shard count is rounded up to a power of two
+    explicit ShardedAccumulator(const std::size_t shard_count = std::thread::hardware_concurrency())
+        : m_shard_count(std::bit_ceil(std::max(shard_count, std::size_t(1))))
+        , m_shards(std::make_unique<Shard[]>(m_shard_count))
+    {
+    }
+
+    ShardedAccumulator& operator+=(const value_type value) noexcept
+    {
+        shard().value.fetch_add(value.raw(), std::memory_order_relaxed);
+        return *this;
+    }
+
+    ShardedAccumulator& operator-=(const value_type value) noexcept
+    {
+        shard().value.fetch_sub(value.raw(), std::memory_order_relaxed);
+        return *this;
+    }
+
+    // Not a snapshot. Writes which happen concurrently with the read may or may not be included.
+    [[nodiscard]] value_type load() const noexcept
+    {
+        IntType total = 0;
+        for (std::size_t i = 0; i < m_shard_count; ++i)
+            total = IntType(total + m_shards[i].value.load(std::memory_order_relaxed));
+        return value_type::from_raw(total);
+    }
+
+    [[nodiscard]] std::size_t shard_count() const noexcept
+    {
+        return m_shard_count;
+    }
+
+private:
+    struct alignas(detail::cache_line_size) Shard {
+        std::atomic<IntType> value { 0 };
+    };
+
+    [[nodiscard]] Shard& shard() noexcept
+    {
+        return m_shards[detail::thread_index() & (m_shard_count - 1)];
+    }
+
+    std::size_t m_shard_count;
+    std::unique_ptr<Shard[]> m_shards;
+};
+}
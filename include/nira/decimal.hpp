@@ -0,0 +1,435 @@
+#pragma once
+
+#include <nira/detail/integer.hpp>
+#include <nira/fixed_point.hpp>
+#include <nira/rational.hpp>
+
+#include <cassert>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace nira {
+// Decimal floating point number, coefficient * 10^exponent, packed into a single integer.
+// The low 8 bits hold the exponent and the remaining bits hold the coefficient.
+template <std::signed_integral IntType = std::int64_t>
+class Decimal {
+    static_assert(sizeof(IntType) >= 4, "Integer type must be at least 32 bits wide");
+
+    using WideType = detail::wider_t<IntType>;
+
+public:
+    static constexpr int exponent_bits = 8;
+    static constexpr int min_exponent = -128;
+    static constexpr int max_exponent = 127;
+    static constexpr IntType max_coefficient = IntType((IntType(1) << (sizeof(IntType) * 8 - exponent_bits - 1)) - 1);
+
+    constexpr Decimal() noexcept = default;
+
+    explicit constexpr Decimal(const IntType coefficient, const int exponent = 0) noexcept
+        : Decimal(normalize(WideType(coefficient), exponent))
+    {
+    }
+
+    template <std::uint8_t scale, std::signed_integral U>
+    explicit constexpr Decimal(const FixedPoint<scale, U>& fixed) noexcept
+        : Decimal(normalize(WideType(fixed.raw()), -int(scale)))
+    {
+    }
+
+    // Truncates toward zero if the value has no exact decimal representation
+    template <std::signed_integral U>
+    explicit constexpr Decimal(const Rational<U>& value) noexcept
+        : Decimal(from_rational(value))
+    {
+    }
+
+    // Accepts text like "-12.345", "1e-8", or "6.02E23"
+    [[nodiscard]] static constexpr std::optional<Decimal> parse(const std::string_view text) noexcept
+    {
+        auto it = text.begin();
+        const auto negative = it != text.end() && *it == '-';
+        if (it != text.end() && (*it == '-' || *it == '+'))
+            ++it;
+
+        WideType coefficient = 0;
+        auto exponent = 0;
+        auto digits = 0;
+        auto fractional = false;
+        for (; it != text.end(); ++it) {
+            if (*it == '.' && !fractional) {
+                fractional = true;
+                continue;
+            }
+            if (*it < '0' || *it > '9')
+                break;
+            ++digits;
+            if (coefficient <= parse_limit) {
+                coefficient = WideType(coefficient * 10 + (*it - '0'));
+                if (fractional)
+                    --exponent;
+            } else if (!fractional) {
+                ++exponent; // Drop digits which exceed the available precision
+            }
+        }
+        if (digits == 0)
+            return std::nullopt;
+
+        if (it != text.end() && (*it == 'e' || *it == 'E')) {
+            ++it;
+            const auto negative_exponent = it != text.end() && *it == '-';
+            if (it != text.end() && (*it == '-' || *it == '+'))
+                ++it;
+            if (it == text.end())
+                return std::nullopt;
+            auto value = 0;
+            for (; it != text.end() && *it >= '0' && *it <= '9'; ++it) {
+                value = value * 10 + (*it - '0');
+                if (value > 1'000)
+                    return std::nullopt;
+            }
+            exponent += negative_exponent ? -value : value;
+        }
+        if (it != text.end())
+            return std::nullopt;
+
+        // Reject values too large to represent
+        auto magnitude_exponent = exponent - 1;
+        for (auto remaining = coefficient; remaining != 0; remaining /= 10)
+            ++magnitude_exponent;
+        if (coefficient != 0 && magnitude_exponent > max_exponent + coefficient_digits - 1)
+            return std::nullopt;
+
+        return normalize(negative ? WideType(-coefficient) : coefficient, exponent);
+    }
+
+    [[nodiscard]] constexpr IntType coefficient() const noexcept
+    {
+        return IntType(m_value >> exponent_bits);
+    }
+
+    [[nodiscard]] constexpr int exponent() const noexcept
+    {
+        return std::int8_t(m_value & 0xFF);
+    }
+
+    // Truncates toward zero when the value has more fractional digits than the scale
+    template <std::uint8_t scale, std::signed_integral U>
+    [[nodiscard]] explicit constexpr operator FixedPoint<scale, U>() const noexcept
+    {
+        using ResultType = std::common_type_t<WideType, detail::wider_t<U>>;
+        const auto value = ResultType(coefficient());
+        const auto shift = exponent() + int(scale);
+        if (shift >= 0)
+            return FixedPoint<scale, U>::from_raw(U(value * detail::power_of_ten<ResultType>(shift)));
+        if (-shift > wide_digits)
+            return {};
+        return FixedPoint<scale, U>::from_raw(U(value / detail::power_of_ten<ResultType>(-shift)));
+    }
+
+    // Computed and reduced in the wide type so only the reduced fraction has to fit in U
+    template <std::signed_integral U>
+    [[nodiscard]] explicit constexpr operator Rational<U>() const noexcept
+    {
+        constexpr auto min = WideType(std::numeric_limits<U>::min());
+        constexpr auto max = WideType(std::numeric_limits<U>::max());
+        auto num = WideType(coefficient());
+        auto den = WideType(1);
+        if (exponent() >= 0) {
+            assert(exponent() <= std::numeric_limits<U>::digits10);
+            const auto factor = detail::power_of_ten<WideType>(exponent());
+            assert(num >= min / factor && num <= max / factor);
+            num = WideType(num * factor);
+        } else {
+            assert(-exponent() <= wide_digits);
+            den = detail::power_of_ten<WideType>(-exponent());
+            const auto gcd = detail::gcd(num, den);
+            num = WideType(num / gcd);
+            den = WideType(den / gcd);
+        }
+        assert(num >= min && num <= max && den <= max);
+        return Rational<U>::from_reduced(U(num), U(den));
+    }
+
+    [[nodiscard]] constexpr Decimal operator-() const noexcept
+    {
+        return from_parts(IntType(-coefficient()), exponent());
+    }
+
+    [[nodiscard]] constexpr Decimal operator+(const Decimal& value) const noexcept
+    {
+        if (exponent() == value.exponent()) {
+            // Cannot overflow since the coefficient is at least 8 bits narrower than the integer type
+            const auto sum = IntType(coefficient() + value.coefficient());
+            if (sum >= -max_coefficient && sum <= max_coefficient)
+                return from_parts(sum, exponent());
+            return normalize(WideType(sum), exponent());
+        }
+        const auto [lhs, rhs, common_exponent] = align(value);
+        return normalize(WideType(lhs + rhs), common_exponent);
+    }
+
+    constexpr Decimal& operator+=(const Decimal& value) & noexcept
+    {
+        return *this = *this + value;
+    }
+
+    [[nodiscard]] constexpr Decimal operator-(const Decimal& value) const noexcept
+    {
+        return *this + -value;
+    }
+
+    constexpr Decimal& operator-=(const Decimal& value) & noexcept
+    {
+        return *this = *this - value;
+    }
+
+    [[nodiscard]] constexpr Decimal operator*(const Decimal& value) const noexcept
+    {
+        auto lhs = WideType(coefficient());
+        auto rhs = WideType(value.coefficient());
+        auto exponent = this->exponent() + value.exponent();
+        if constexpr (sizeof(WideType) == sizeof(IntType)) {
+            // Without a wider type, drop the least significant digits of the longer operand until the product fits
+            auto lhs_digits = digit_count(lhs);
+            auto rhs_digits = digit_count(rhs);
+            while (lhs_digits + rhs_digits > wide_digits) {
+                if (lhs_digits >= rhs_digits) {
+                    lhs = WideType(lhs / 10);
+                    --lhs_digits;
+                } else {
+                    rhs = WideType(rhs / 10);
+                    --rhs_digits;
+                }
+                ++exponent;
+            }
+        }
+        return normalize(WideType(lhs * rhs), exponent);
+    }
+
+    constexpr Decimal& operator*=(const Decimal& value) & noexcept
+    {
+        return *this = *this * value;
+    }
+
+    // Truncates toward zero after computing as many digits as the coefficient can hold
+    [[nodiscard]] constexpr Decimal operator/(const Decimal& value) const noexcept
+    {
+        // Long division which stops once the quotient cannot hold another digit
+        const auto divisor = WideType(value.coefficient());
+        auto dividend = WideType(coefficient());
+        auto exponent = this->exponent() - value.exponent();
+        while (dividend >= -detail::max_value<WideType>() / 10 && dividend <= detail::max_value<WideType>() / 10
+               && dividend != 0) {
+            dividend = WideType(dividend * 10);
+            --exponent;
+        }
+        auto quotient = WideType(dividend / divisor);
+        auto remainder = WideType(dividend % divisor);
+        while (remainder != 0 && quotient >= -max_coefficient / 10 && quotient <= max_coefficient / 10) {
+            remainder = WideType(remainder * 10);
+            quotient = WideType(quotient * 10 + remainder / divisor);
+            remainder = WideType(remainder % divisor);
+            --exponent;
+        }
+
+        // Exact quotients drop the zeros padded on above, stopping at the exponent of an unpadded quotient
+        const auto ideal_exponent = this->exponent() - value.exponent();
+        while (remainder == 0 && exponent < ideal_exponent && quotient % 10 == 0) {
+            quotient = WideType(quotient / 10);
+            ++exponent;
+        }
+        return normalize(quotient, exponent);
+    }
+
+    constexpr Decimal& operator/=(const Decimal& value) & noexcept
+    {
+        return *this = *this / value;
+    }
+
+    [[nodiscard]] constexpr bool operator==(const Decimal& value) const noexcept
+    {
+        return (*this <=> value) == 0;
+    }
+
+    // Weak because equal values may have different representations, e.g. 1 and 1.0
+    [[nodiscard]] constexpr std::weak_ordering operator<=>(const Decimal& value) const noexcept
+    {
+        if (exponent() == value.exponent() || coefficient() == 0 || value.coefficient() == 0
+            || (coefficient() < 0) != (value.coefficient() < 0))
+            return coefficient() <=> value.coefficient();
+        if (exponent() - value.exponent() <= alignment_limit && value.exponent() - exponent() <= alignment_limit) {
+            const auto [lhs, rhs, _] = align(value);
+            return lhs <=> rhs;
+        }
+
+        // Otherwise the operand whose most significant digit is in a higher place has the larger magnitude
+        const auto lhs_top = exponent() + digit_count(coefficient());
+        const auto rhs_top = value.exponent() + digit_count(value.coefficient());
+        if (lhs_top != rhs_top)
+            return coefficient() < 0 ? rhs_top <=> lhs_top : lhs_top <=> rhs_top;
+
+        // Both coefficients fit within the precision of the coefficient once aligned on the smaller exponent
+        if (exponent() > value.exponent())
+            return WideType(coefficient() * detail::power_of_ten<WideType>(exponent() - value.exponent()))
+                <=> value.coefficient();
+        return coefficient()
+            <=> WideType(value.coefficient() * detail::power_of_ten<WideType>(value.exponent() - exponent()));
+    }
+
+private:
+    struct AlignedCoefficients {
+        WideType lhs {};
+        WideType rhs {};
+        int exponent {};
+    };
+
+    // Largest power of ten a coefficient can be scaled by without overflowing the wide type
+    [[nodiscard]] static consteval int compute_alignment_limit() noexcept
+    {
+        auto limit = 0;
+        auto value = WideType(max_coefficient);
+        while (value <= (detail::max_value<WideType>() - max_coefficient) / 10) {
+            value = WideType(value * 10);
+            ++limit;
+        }
+        return limit;
+    }
+
+    // Largest number of decimal digits such that every number with that many digits fits within the value
+    [[nodiscard]] static consteval int count_digits(const WideType value) noexcept
+    {
+        auto digits = 0;
+        for (WideType nines = 9; nines <= value; nines = WideType(nines * 10 + 9)) {
+            ++digits;
+            if (nines > (detail::max_value<WideType>() - 9) / 10)
+                break;
+        }
+        return digits;
+    }
+
+    [[nodiscard]] static constexpr int digit_count(WideType value) noexcept
+    {
+        auto digits = 0;
+        for (; value != 0; value = WideType(value / 10))
+            ++digits;
+        return digits;
+    }
+
+    static constexpr int alignment_limit = compute_alignment_limit();
+    static constexpr int coefficient_digits = count_digits(max_coefficient);
+    static constexpr int wide_digits = count_digits(detail::max_value<WideType>());
+
+    // Parsing stops accumulating digits once another digit could overflow the wide type
+    static constexpr WideType parse_limit = WideType((detail::max_value<WideType>() - 9) / 10);
+
+    [[nodiscard]] static constexpr Decimal from_parts(const IntType coefficient, const int exponent) noexcept
+    {
+        Decimal decimal;
+        decimal.m_value = IntType(IntType(coefficient * (IntType(1) << exponent_bits)) | (exponent & 0xFF));
+        return decimal;
+    }
+
+    // Drop least significant digits until the coefficient and exponent are in range.
+    // This is lossless when the dropped digits are all zero.
+    [[nodiscard]] static constexpr Decimal normalize(WideType coefficient, int exponent) noexcept
+    {
+        const auto magnitude = coefficient < 0 ? WideType(-coefficient) : coefficient;
+        auto drop = 0;
+        for (auto limit = WideType(max_coefficient); magnitude > limit; ++drop) {
+            if (limit > (detail::max_value<WideType>() - 9) / 10) {
+                ++drop;
+                break;
+            }
+            limit = WideType(limit * 10 + 9);
+        }
+        if (exponent + drop < min_exponent)
+            drop = min_exponent - exponent;
+        if (drop > 0) {
+            coefficient = drop > wide_digits ? 0 : WideType(coefficient / detail::power_of_ten<WideType>(drop));
+            exponent += drop;
+        }
+
+        // Trade exponent for coefficient digits when the exponent is too large
+        while (exponent > max_exponent && coefficient >= -max_coefficient / 10 && coefficient <= max_coefficient / 10) {
+            coefficient = WideType(coefficient * 10);
+            --exponent;
+        }
+        assert(exponent <= max_exponent);
+        if (coefficient == 0)
+            exponent = 0;
+        return from_parts(IntType(coefficient), exponent);
+    }
+
+    template <std::signed_integral U>
+    [[nodiscard]] static constexpr Decimal from_rational(const Rational<U>& value) noexcept
+    {
+        // Long division which stops once the coefficient cannot hold another digit
+        using ResultType = std::common_type_t<WideType, detail::wider_t<U>>;
+        const auto den = ResultType(value.denominator());
+        auto coefficient = ResultType(value.numerator() / value.denominator());
+        auto remainder = ResultType(value.numerator() % value.denominator());
+        auto exponent = 0;
+        while (remainder != 0 && coefficient >= -max_coefficient / 10 && coefficient <= max_coefficient / 10) {
+            remainder = ResultType(remainder * 10);
+            coefficient = ResultType(coefficient * 10 + remainder / den);
+            remainder = ResultType(remainder % den);
+            --exponent;
+        }
+        return normalize(WideType(coefficient), exponent);
+    }
+
+    [[nodiscard]] constexpr AlignedCoefficients align(const Decimal& value) const noexcept
+    {
+        // Scale up the coefficient with the larger exponent so both share the smaller exponent.
+        // Digits of the other coefficient which fall beyond the available precision are truncated.
+        if (value.exponent() > exponent()) {
+            const auto [rhs, lhs, shared_exponent] = value.align(*this);
+            return { lhs, rhs, shared_exponent };
+        }
+        auto lhs = WideType(coefficient());
+        const auto rhs = WideType(value.coefficient());
+        const auto difference = exponent() - value.exponent();
+        if (difference <= alignment_limit)
+            return { WideType(lhs * detail::power_of_ten<WideType>(difference)), rhs, value.exponent() };
+
+        auto scaled = 0;
+        constexpr auto scale_limit = WideType((detail::max_value<WideType>() - max_coefficient) / 10);
+        while (scaled < difference && lhs >= -scale_limit && lhs <= scale_limit) {
+            lhs = WideType(lhs * 10);
+            ++scaled;
+        }
+        const auto drop = difference - scaled;
+        return { lhs,
+                 drop > wide_digits ? WideType(0) : WideType(rhs / detail::power_of_ten<WideType>(drop)),
+                 exponent() - scaled };
+    }
+
+    IntType m_value { 0 };
+};
+}
+
+template <typename IntType>
+std::ostream& operator<<(std::ostream& out, const nira::Decimal<IntType>& value)
+{
+    const auto coefficient = value.coefficient();
+    const auto exponent = value.exponent();
+    auto digits = std::to_string(coefficient < 0 ? -coefficient : coefficient);
+    if (exponent >= 0) {
+        digits.append(std::string::size_type(exponent), '0');
+    } else {
+        const auto fractional_digits = std::string::size_type(-exponent);
+        if (digits.size() <= fractional_digits)
+            digits.insert(0, fractional_digits - digits.size() + 1, '0');
+        digits.insert(digits.size() - fractional_digits, 1, '.');
+    }
+    if (coefficient < 0)
+        out << '-';
+    return out << digits;
+}
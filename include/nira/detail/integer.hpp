@@ -0,0 +1,93 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace nira::detail {
+#ifdef __SIZEOF_INT128__
+__extension__ using WidestInt = __int128;
+#else
+using WidestInt = std::int64_t;
+#endif
+
+// Standard signed integer types plus the compiler's 128-bit integer type, if any.
+// Unlike std::signed_integral this holds for 128-bit integers even when compiler extensions are disabled.
+template <typename IntType>
+concept SignedInteger = std::signed_integral<IntType> || std::same_as<IntType, WidestInt>;
+
+// Signed integers which convert to IntType without narrowing
+template <typename T, typename IntType>
+concept NonNarrowingInteger = std::signed_integral<T> && sizeof(T) <= sizeof(IntType);
+
+// Next larger signed integer type, used to hold intermediate results without overflowing.
+// 64-bit integers only widen when the compiler provides a 128-bit integer type.
+template <std::size_t size>
+struct Wider {
+    using type = WidestInt;
+};
+
+template <>
+struct Wider<1> {
+    using type = std::int16_t;
+};
+
+template <>
+struct Wider<2> {
+    using type = std::int32_t;
+};
+
+template <>
+struct Wider<4> {
+    using type = std::int64_t;
+};
+
+template <typename IntType>
+using wider_t = typename Wider<sizeof(IntType)>::type;
+
+// Whichever integer type is wider
+template <typename Lhs, typename Rhs>
+using larger_t = std::conditional_t<(sizeof(Lhs) >= sizeof(Rhs)), Lhs, Rhs>;
+
+// Like std::numeric_limits<IntType>::max() but also usable with extended integer types
+template <typename IntType>
+[[nodiscard]] consteval IntType max_value() noexcept
+{
+    constexpr auto half = IntType(IntType(1) << (sizeof(IntType) * 8 - 2));
+    return IntType(half - 1 + half);
+}
+
+// Like std::gcd but also usable with extended integer types
+template <typename IntType>
+[[nodiscard]] constexpr IntType gcd(IntType lhs, IntType rhs) noexcept
+{
+    if (lhs < 0)
+        lhs = IntType(-lhs);
+    if (rhs < 0)
+        rhs = IntType(-rhs);
+    while (rhs != 0)
+        lhs = std::exchange(rhs, IntType(lhs % rhs));
+    return lhs;
+}
+
+// Like std::lcm but also usable with extended integer types
+template <typename IntType>
+[[nodiscard]] constexpr IntType lcm(const IntType lhs, const IntType rhs) noexcept
+{
+    if (lhs == 0 || rhs == 0)
+        return 0;
+    const auto value = IntType(lhs / gcd(lhs, rhs) * rhs);
+    return value < 0 ? IntType(-value) : value;
+}
+
+template <typename IntType>
+[[nodiscard]] constexpr IntType power_of_ten(int exponent) noexcept
+{
+    IntType value = 1;
+    while (exponent-- > 0)
+        value = IntType(value * 10);
+    return value;
+}
+}
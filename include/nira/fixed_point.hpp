@@ -1,12 +1,16 @@
 #pragma once
 
+#include <nira/detail/integer.hpp>
+#include <nira/rational.hpp>
+
 #include <concepts>
 #include <cstdint>
 #include <iomanip>
 #include <ostream>
+#include <string>
 
 namespace nira {
-template <std::uint8_t scale, std::signed_integral IntType = int>
+template <std::uint8_t scale, detail::SignedInteger IntType = int>
 class FixedPoint {
     static_assert(scale > 0, "Scale factor must be greater than zero");
 
@@ -24,6 +28,31 @@ public:
     {
     }
 
+    // Rescales to a different scale or integer type, truncating toward zero when the scale decreases
+    template <std::uint8_t other_scale, detail::SignedInteger OtherInt>
+        requires(other_scale != scale || !std::same_as<OtherInt, IntType>)
+    explicit constexpr FixedPoint(const FixedPoint<other_scale, OtherInt>& fixed) noexcept
+    {
+        using CommonType = detail::larger_t<IntType, OtherInt>;
+        if constexpr (scale >= other_scale)
+            m_value = IntType(CommonType(fixed.raw()) * detail::power_of_ten<CommonType>(scale - other_scale));
+        else
+            m_value = IntType(CommonType(fixed.raw()) / detail::power_of_ten<CommonType>(other_scale - scale));
+    }
+
+    // Construct directly from the underlying integer, e.g. 1234 is 12.34 when scale is 2
+    [[nodiscard]] static constexpr FixedPoint from_raw(const IntType raw) noexcept
+    {
+        FixedPoint fixed;
+        fixed.m_value = raw;
+        return fixed;
+    }
+
+    [[nodiscard]] constexpr IntType raw() const noexcept
+    {
+        return m_value;
+    }
+
     [[nodiscard]] constexpr IntType whole() const noexcept
     {
         return m_value / factor;
@@ -79,6 +108,59 @@ public:
         return *this;
     }
 
+    // Multiplying the underlying integers yields the exact product at the sum of both scales.
+    // The result uses a wider integer type so the product cannot overflow, except when there is no wider type:
+    // 64-bit operands without a 128-bit integer type, or 128-bit operands, may still overflow.
+    template <std::uint8_t other_scale, detail::SignedInteger OtherInt>
+        requires(other_scale != scale || !std::same_as<OtherInt, IntType>)
+    [[nodiscard]] constexpr auto operator*(const FixedPoint<other_scale, OtherInt>& fixed) const noexcept
+    {
+        static_assert(scale + other_scale <= 255, "Scale of product must fit in std::uint8_t");
+        using ResultType = detail::wider_t<detail::larger_t<IntType, OtherInt>>;
+        return FixedPoint<std::uint8_t(scale + other_scale), ResultType>::from_raw(
+            ResultType(ResultType(m_value) * ResultType(fixed.raw())));
+    }
+
+    // Integer operands are unscaled so no rescaling is required.
+    // Floating point, unsigned, and wider integer operands are rejected rather than implicitly narrowed.
+    template <detail::NonNarrowingInteger<IntType> T>
+    [[nodiscard]] constexpr FixedPoint operator*(const T value) const noexcept
+    {
+        return from_raw(IntType(m_value * IntType(value)));
+    }
+
+    template <detail::NonNarrowingInteger<IntType> T>
+    [[nodiscard]] friend constexpr FixedPoint operator*(const T value, const FixedPoint& fixed) noexcept
+    {
+        return fixed * value;
+    }
+
+    template <detail::NonNarrowingInteger<IntType> T>
+    constexpr FixedPoint& operator*=(const T value) & noexcept
+    {
+        m_value *= IntType(value);
+        return *this;
+    }
+
+    // Only matches Rational itself so types which convert to both Rational and FixedPoint, like Lazy, are not ambiguous
+    template <std::same_as<Rational<IntType>> R>
+    [[nodiscard]] constexpr FixedPoint operator*(const R& value) const noexcept
+    {
+        return from_raw(IntType(m_value * value.numerator() / value.denominator()));
+    }
+
+    template <std::same_as<Rational<IntType>> R>
+    [[nodiscard]] friend constexpr FixedPoint operator*(const R& value, const FixedPoint& fixed) noexcept
+    {
+        return fixed * value;
+    }
+
+    template <std::same_as<Rational<IntType>> R>
+    constexpr FixedPoint& operator*=(const R& value) & noexcept
+    {
+        return *this = *this * value;
+    }
+
     [[nodiscard]] constexpr FixedPoint operator/(FixedPoint fixed) const noexcept
     {
         fixed.m_value = m_value * factor / fixed.m_value;
@@ -92,6 +174,31 @@ public:
         return *this;
     }
 
+    template <detail::NonNarrowingInteger<IntType> T>
+    [[nodiscard]] constexpr FixedPoint operator/(const T value) const noexcept
+    {
+        return from_raw(IntType(m_value / IntType(value)));
+    }
+
+    template <detail::NonNarrowingInteger<IntType> T>
+    constexpr FixedPoint& operator/=(const T value) & noexcept
+    {
+        m_value /= IntType(value);
+        return *this;
+    }
+
+    template <std::same_as<Rational<IntType>> R>
+    [[nodiscard]] constexpr FixedPoint operator/(const R& value) const noexcept
+    {
+        return from_raw(IntType(m_value * value.denominator() / value.numerator()));
+    }
+
+    template <std::same_as<Rational<IntType>> R>
+    constexpr FixedPoint& operator/=(const R& value) & noexcept
+    {
+        return *this = *this / value;
+    }
+
     [[nodiscard]] constexpr auto operator<=>(const FixedPoint&) const noexcept = default;
 
 private:
@@ -109,16 +216,7 @@ private:
         return -1;
     }
 
-    [[nodiscard]] static consteval IntType power_of_ten() noexcept
-    {
-        auto exponent = scale;
-        IntType value = 1;
-        while (exponent-- > 0)
-            value *= 10;
-        return value;
-    }
-
-    static constexpr IntType factor = power_of_ten();
+    static constexpr IntType factor = detail::power_of_ten<IntType>(scale);
 
     IntType m_value { 0 };
 };
@@ -127,5 +225,21 @@ private:
 template <std::uint8_t scale, typename IntType>
 std::ostream& operator<<(std::ostream& out, const nira::FixedPoint<scale, IntType>& fixed)
 {
-    return out << +fixed.whole() << '.' << std::setfill('0') << std::setw(scale) << +fixed.fractional();
+    if constexpr (std::signed_integral<IntType>) {
+        return out << +fixed.whole() << '.' << std::setfill('0') << std::setw(scale) << +fixed.fractional();
+    } else {
+        // Extended integer types have no stream operators
+        const auto to_string = [](IntType value) {
+            std::string digits;
+            const auto negative = value < 0;
+            do {
+                const auto digit = IntType(value % 10);
+                digits.insert(digits.begin(), char('0' + (negative ? -digit : digit)));
+                value = IntType(value / 10);
+            } while (value != 0);
+            return negative ? '-' + digits : digits;
+        };
+        return out << to_string(fixed.whole()) << '.' << std::setfill('0') << std::setw(scale)
+                   << to_string(fixed.fractional());
+    }
 }
@@ -0,0 +1,285 @@
+#pragma once
+
+#include <nira/detail/integer.hpp>
+#include <nira/fixed_point.hpp>
+#include <nira/rational.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+
+namespace nira {
+template <typename Expr>
+class Lazy;
+
+namespace detail {
+    // Exact value of a subexpression, num / (den * 10^exponent), where the exponent is known at compile time.
+    // Neither half is ever reduced.
+    template <typename WideType>
+    struct Fraction {
+        WideType num { 0 };
+        WideType den { 1 };
+    };
+
+    template <typename T>
+    struct Leaf;
+
+    template <std::uint8_t scale, typename IntType>
+    struct Leaf<FixedPoint<scale, IntType>> {
+        using wide_type = wider_t<IntType>;
+        static constexpr int exponent = scale;
+
+        [[nodiscard]] constexpr Fraction<wide_type> evaluate() const noexcept
+        {
+            return { wide_type(value.raw()), 1 };
+        }
+
+        FixedPoint<scale, IntType> value;
+    };
+
+    template <typename IntType>
+    struct Leaf<Rational<IntType>> {
+        using wide_type = wider_t<IntType>;
+        static constexpr int exponent = 0;
+
+        [[nodiscard]] constexpr Fraction<wide_type> evaluate() const noexcept
+        {
+            return { wide_type(value.numerator()), wide_type(value.denominator()) };
+        }
+
+        Rational<IntType> value;
+    };
+
+    template <std::signed_integral IntType>
+    struct Leaf<IntType> {
+        using wide_type = wider_t<IntType>;
+        static constexpr int exponent = 0;
+
+        [[nodiscard]] constexpr Fraction<wide_type> evaluate() const noexcept
+        {
+            return { wide_type(value), 1 };
+        }
+
+        IntType value;
+    };
+
+    struct Add {
+        template <int lhs_exponent, int rhs_exponent>
+        static constexpr int exponent = std::max(lhs_exponent, rhs_exponent);
+
+        template <int lhs_exponent, int rhs_exponent, typename WideType>
+        [[nodiscard]] static constexpr Fraction<WideType> apply(const Fraction<WideType>& lhs,
+                                                                const Fraction<WideType>& rhs) noexcept
+        {
+            constexpr auto result_exponent = exponent<lhs_exponent, rhs_exponent>;
+            constexpr auto lhs_factor = power_of_ten<WideType>(result_exponent - lhs_exponent);
+            constexpr auto rhs_factor = power_of_ten<WideType>(result_exponent - rhs_exponent);
+            if (lhs.den == rhs.den)
+                return { WideType(lhs.num * lhs_factor + rhs.num * rhs_factor), lhs.den };
+            return { WideType(lhs.num * lhs_factor * rhs.den + rhs.num * rhs_factor * lhs.den),
+                     WideType(lhs.den * rhs.den) };
+        }
+    };
+
+    struct Subtract {
+        template <int lhs_exponent, int rhs_exponent>
+        static constexpr int exponent = Add::exponent<lhs_exponent, rhs_exponent>;
+
+        template <int lhs_exponent, int rhs_exponent, typename WideType>
+        [[nodiscard]] static constexpr Fraction<WideType> apply(const Fraction<WideType>& lhs,
+                                                                const Fraction<WideType>& rhs) noexcept
+        {
+            return Add::apply<lhs_exponent, rhs_exponent>(lhs, { WideType(-rhs.num), rhs.den });
+        }
+    };
+
+    struct Multiply {
+        template <int lhs_exponent, int rhs_exponent>
+        static constexpr int exponent = lhs_exponent + rhs_exponent;
+
+        template <int, int, typename WideType>
+        [[nodiscard]] static constexpr Fraction<WideType> apply(const Fraction<WideType>& lhs,
+                                                                const Fraction<WideType>& rhs) noexcept
+        {
+            return { WideType(lhs.num * rhs.num), WideType(lhs.den * rhs.den) };
+        }
+    };
+
+    struct Divide {
+        template <int lhs_exponent, int rhs_exponent>
+        static constexpr int exponent = lhs_exponent - rhs_exponent;
+
+        template <int, int, typename WideType>
+        [[nodiscard]] static constexpr Fraction<WideType> apply(const Fraction<WideType>& lhs,
+                                                                const Fraction<WideType>& rhs) noexcept
+        {
+            if (lhs.den == rhs.den)
+                return { lhs.num, rhs.num };
+            return { WideType(lhs.num * rhs.den), WideType(lhs.den * rhs.num) };
+        }
+    };
+
+    template <typename Op, typename Lhs, typename Rhs>
+    struct Binary {
+        using wide_type = std::common_type_t<typename Lhs::wide_type, typename Rhs::wide_type>;
+        static constexpr int exponent = Op::template exponent<Lhs::exponent, Rhs::exponent>;
+
+        [[nodiscard]] constexpr Fraction<wide_type> evaluate() const noexcept
+        {
+            const auto lhs_value = lhs.evaluate();
+            const auto rhs_value = rhs.evaluate();
+            return Op::template apply<Lhs::exponent, Rhs::exponent>(
+                Fraction<wide_type> { lhs_value.num, lhs_value.den },
+                Fraction<wide_type> { rhs_value.num, rhs_value.den });
+        }
+
+        Lhs lhs;
+        Rhs rhs;
+    };
+
+    template <typename Expr>
+    struct Negate {
+        using wide_type = typename Expr::wide_type;
+        static constexpr int exponent = Expr::exponent;
+
+        [[nodiscard]] constexpr Fraction<wide_type> evaluate() const noexcept
+        {
+            const auto value = expr.evaluate();
+            return { wide_type(-value.num), value.den };
+        }
+
+        Expr expr;
+    };
+
+    template <typename T>
+    inline constexpr bool is_lazy = false;
+
+    template <typename Expr>
+    inline constexpr bool is_lazy<Lazy<Expr>> = true;
+
+    template <typename T>
+    concept Leafable = requires(const T& value) { Leaf<T> { value }.evaluate(); };
+
+    template <typename T>
+    concept Operand = is_lazy<T> || Leafable<T>;
+
+    template <typename Lhs, typename Rhs>
+    concept LazyOperands = Operand<Lhs> && Operand<Rhs> && (is_lazy<Lhs> || is_lazy<Rhs>);
+
+    template <typename T>
+    [[nodiscard]] constexpr auto to_expression(const T& value) noexcept
+    {
+        if constexpr (is_lazy<T>)
+            return value.expression();
+        else
+            return Leaf<T> { value };
+    }
+
+    template <typename Op, typename Lhs, typename Rhs>
+    [[nodiscard]] constexpr auto make_lazy(const Lhs& lhs, const Rhs& rhs) noexcept
+    {
+        using Expr = Binary<Op, decltype(to_expression(lhs)), decltype(to_expression(rhs))>;
+        return Lazy<Expr>(Expr { to_expression(lhs), to_expression(rhs) });
+    }
+}
+
+// Deferred arithmetic expression. Intermediate results are kept as an unreduced fraction and are only rounded
+// (FixedPoint) or reduced (Rational) once when converting to the result type.
+// Operands are widened only one level, to the next wider integer type, so long chains can still overflow, e.g. the
+// product of three full-width std::int32_t factors does not fit in std::int64_t.
+// For 64-bit operands every step runs in a 128-bit integer type, which trades speed for precision: such expressions
+// are typically slower than the eager operators.
+template <typename Expr>
+class Lazy {
+public:
+    explicit constexpr Lazy(const Expr& expr) noexcept
+        : m_expr(expr)
+    {
+    }
+
+    [[nodiscard]] constexpr const Expr& expression() const noexcept
+    {
+        return m_expr;
+    }
+
+    [[nodiscard]] constexpr Lazy<detail::Negate<Expr>> operator-() const noexcept
+    {
+        return Lazy<detail::Negate<Expr>>({ m_expr });
+    }
+
+    // Truncates toward zero like the eager FixedPoint operators
+    template <std::uint8_t scale, std::signed_integral IntType>
+    [[nodiscard]] constexpr operator FixedPoint<scale, IntType>() const noexcept
+    {
+        using WideType = std::common_type_t<typename Expr::wide_type, detail::wider_t<IntType>>;
+        const auto value = m_expr.evaluate();
+        const auto num = WideType(value.num);
+        const auto den = WideType(value.den);
+        if constexpr (scale >= Expr::exponent) {
+            constexpr auto factor = detail::power_of_ten<WideType>(scale - Expr::exponent);
+            return FixedPoint<scale, IntType>::from_raw(IntType(num * factor / den));
+        } else {
+            constexpr auto factor = detail::power_of_ten<WideType>(Expr::exponent - scale);
+            return FixedPoint<scale, IntType>::from_raw(IntType(num / (den * factor)));
+        }
+    }
+
+    template <std::signed_integral IntType>
+    [[nodiscard]] constexpr operator Rational<IntType>() const noexcept
+    {
+        using WideType = std::common_type_t<typename Expr::wide_type, detail::wider_t<IntType>>;
+        const auto value = m_expr.evaluate();
+        auto num = WideType(value.num);
+        auto den = WideType(value.den);
+        if constexpr (Expr::exponent >= 0)
+            den = WideType(den * detail::power_of_ten<WideType>(Expr::exponent));
+        else
+            num = WideType(num * detail::power_of_ten<WideType>(-Expr::exponent));
+        if (den < 0) {
+            num = WideType(-num);
+            den = WideType(-den);
+        }
+        const auto gcd = detail::gcd(num, den);
+        return Rational<IntType>::from_reduced(IntType(num / gcd), IntType(den / gcd));
+    }
+
+private:
+    Expr m_expr;
+};
+
+// Begin a deferred expression, e.g. FixedPoint<2> total = nira::lazy(price) * quantity / rate;
+template <detail::Leafable T>
+[[nodiscard]] constexpr Lazy<detail::Leaf<T>> lazy(const T& value) noexcept
+{
+    return Lazy<detail::Leaf<T>>({ value });
+}
+
+template <typename Lhs, typename Rhs>
+    requires detail::LazyOperands<Lhs, Rhs>
+[[nodiscard]] constexpr auto operator+(const Lhs& lhs, const Rhs& rhs) noexcept
+{
+    return detail::make_lazy<detail::Add>(lhs, rhs);
+}
+
+template <typename Lhs, typename Rhs>
+    requires detail::LazyOperands<Lhs, Rhs>
+[[nodiscard]] constexpr auto operator-(const Lhs& lhs, const Rhs& rhs) noexcept
+{
+    return detail::make_lazy<detail::Subtract>(lhs, rhs);
+}
+
+template <typename Lhs, typename Rhs>
+    requires detail::LazyOperands<Lhs, Rhs>
+[[nodiscard]] constexpr auto operator*(const Lhs& lhs, const Rhs& rhs) noexcept
+{
+    return detail::make_lazy<detail::Multiply>(lhs, rhs);
+}
+
+template <typename Lhs, typename Rhs>
+    requires detail::LazyOperands<Lhs, Rhs>
+[[nodiscard]] constexpr auto operator/(const Lhs& lhs, const Rhs& rhs) noexcept
+{
+    return detail::make_lazy<detail::Divide>(lhs, rhs);
+}
+}
@@ -1,13 +1,14 @@
 #pragma once
 
+#include <nira/detail/integer.hpp>
+
 #include <cassert>
 #include <concepts>
 #include <limits>
-#include <numeric>
 #include <ostream>
 
 namespace nira {
-template <std::signed_integral IntType = int>
+template <detail::SignedInteger IntType = int>
 class Rational {
 public:
     constexpr Rational() noexcept = default;
@@ -20,7 +21,7 @@ public:
 
         // Reduce fraction
         // Flip signs if both halves of fraction are non-positive
-        auto gcd = std::gcd(m_num, m_den);
+        auto gcd = detail::gcd(m_num, m_den);
         if (m_num <= 0 && m_den < 0)
             gcd *= -1;
         m_num /= gcd;
@@ -35,6 +36,16 @@ public:
     {
     }
 
+    [[nodiscard]] constexpr IntType numerator() const noexcept
+    {
+        return m_num;
+    }
+
+    [[nodiscard]] constexpr IntType denominator() const noexcept
+    {
+        return m_den;
+    }
+
     template <std::floating_point RealType = double>
     [[nodiscard]] constexpr RealType real() const noexcept
     {
@@ -57,6 +68,22 @@ public:
         return *this = *this + value;
     }
 
+    // Adding a multiple of the denominator cannot introduce a common factor so no reduction is required
+    [[nodiscard]] constexpr Rational operator+(const IntType value) const noexcept
+    {
+        return from_reduced(IntType(m_num + value * m_den), m_den);
+    }
+
+    [[nodiscard]] friend constexpr Rational operator+(const IntType lhs, const Rational& rhs) noexcept
+    {
+        return rhs + lhs;
+    }
+
+    constexpr Rational& operator+=(const IntType value) & noexcept
+    {
+        return *this = *this + value;
+    }
+
     [[nodiscard]] constexpr Rational operator-(const Rational& value) const noexcept
     {
         return { *this + -value };
@@ -67,6 +94,16 @@ public:
         return *this = *this - value;
     }
 
+    [[nodiscard]] constexpr Rational operator-(const IntType value) const noexcept
+    {
+        return from_reduced(IntType(m_num - value * m_den), m_den);
+    }
+
+    constexpr Rational& operator-=(const IntType value) & noexcept
+    {
+        return *this = *this - value;
+    }
+
     [[nodiscard]] constexpr Rational operator*(const Rational& value) const noexcept
     {
         return { IntType(m_num * value.m_num), IntType(m_den * value.m_den) };
@@ -77,6 +114,24 @@ public:
         return *this = *this * value;
     }
 
+    // The numerator and denominator are already coprime so only the integer's common factor with the denominator
+    // needs to be removed
+    [[nodiscard]] constexpr Rational operator*(const IntType value) const noexcept
+    {
+        const auto gcd = detail::gcd(value, m_den);
+        return from_reduced(IntType(m_num * IntType(value / gcd)), IntType(m_den / gcd));
+    }
+
+    [[nodiscard]] friend constexpr Rational operator*(const IntType lhs, const Rational& rhs) noexcept
+    {
+        return rhs * lhs;
+    }
+
+    constexpr Rational& operator*=(const IntType value) & noexcept
+    {
+        return *this = *this * value;
+    }
+
     [[nodiscard]] constexpr Rational operator/(const Rational& value) const noexcept
     {
         return { IntType(m_num * value.m_den), IntType(m_den * value.m_num) };
@@ -87,6 +142,18 @@ public:
         return *this = *this / value;
     }
 
+    [[nodiscard]] constexpr Rational operator/(const IntType value) const noexcept
+    {
+        assert(value != 0);
+        const auto gcd = detail::gcd(m_num, value);
+        return from_reduced(IntType(m_num / gcd), IntType(m_den * IntType(value / gcd)));
+    }
+
+    constexpr Rational& operator/=(const IntType value) & noexcept
+    {
+        return *this = *this / value;
+    }
+
     [[nodiscard]] constexpr bool operator==(const Rational& value) const noexcept = default;
 
     [[nodiscard]] constexpr auto operator<=>(const Rational& value) const noexcept
@@ -102,18 +169,38 @@ private:
         IntType lcm {};
     };
 
+    // Skips reduction for fractions known to be in lowest terms but applies the same sign convention
+    [[nodiscard]] static constexpr Rational from_reduced(const IntType numerator, const IntType denominator) noexcept
+    {
+        Rational value;
+        value.m_num = numerator;
+        value.m_den = denominator;
+        if (value.m_num <= 0 && value.m_den < 0) {
+            value.m_num = IntType(-value.m_num);
+            value.m_den = IntType(-value.m_den);
+        }
+        return value;
+    }
+
     [[nodiscard]] constexpr ScaledNumerators to_common_denominator(const Rational& value) const noexcept
     {
         // Scale each such fraction such that the denominators are equal to their least commmon multiple.
         // This minimizes how much we have to raise the magnitude of the numerator which improves precision.
-        const auto lcm = std::lcm(m_den, value.m_den);
+        const auto lcm = detail::lcm(m_den, value.m_den);
         return { IntType(m_num * (lcm / m_den)), IntType(value.m_num * (lcm / value.m_den)), lcm };
     }
 
     // Required for converting constructor
-    template <std::signed_integral>
+    template <detail::SignedInteger>
     friend class Rational;
 
+    // Lazy and Decimal reduce their results themselves and construct them with from_reduced
+    template <typename>
+    friend class Lazy;
+
+    template <std::signed_integral>
+    friend class Decimal;
+
     template <typename T>
     friend std::ostream& operator<<(std::ostream& out, const Rational<T>& value);
 
@@ -0,0 +1,270 @@
+#pragma once
+
+#include <nira/detail/integer.hpp>
+#include <nira/fixed_point.hpp>
+#include <nira/lazy.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace nira {
+// Fixed capacity FIFO queue. Storage is allocated once on construction and reused as values are pushed and popped.
+template <typename T>
+class RingBuffer {
+public:
+    using value_type = T;
+
+    explicit RingBuffer(const std::size_t capacity)
+        : m_capacity(capacity)
+        , m_values(std::make_unique<T[]>(capacity))
+    {
+    }
+
+    void push_back(const T& value) noexcept(std::is_nothrow_copy_assignable_v<T>)
+    {
+        assert(!full());
+        m_values[index(m_size)] = value;
+        ++m_size;
+    }
+
+    // The popped value is not destroyed until a later push overwrites it
+    void pop_front() noexcept
+    {
+        assert(!empty());
+        m_front = index(1);
+        --m_size;
+    }
+
+    [[nodiscard]] const T& front() const noexcept
+    {
+        assert(!empty());
+        return m_values[m_front];
+    }
+
+    [[nodiscard]] const T& back() const noexcept
+    {
+        assert(!empty());
+        return m_values[index(m_size - 1)];
+    }
+
+    // Index zero is the oldest value
+    [[nodiscard]] const T& operator[](const std::size_t i) const noexcept
+    {
+        assert(i < m_size);
+        return m_values[index(i)];
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    [[nodiscard]] bool full() const noexcept
+    {
+        return m_size == m_capacity;
+    }
+
+private:
+    // Offsets never exceed the capacity so wrapping around needs a subtraction rather than a division
+    [[nodiscard]] std::size_t index(const std::size_t offset) const noexcept
+    {
+        const auto i = m_front + offset;
+        return i >= m_capacity ? i - m_capacity : i;
+    }
+
+    std::size_t m_capacity;
+    std::unique_ptr<T[]> m_values;
+    std::size_t m_front { 0 };
+    std::size_t m_size { 0 };
+};
+
+// Count, sum, and sum of squares of a stream of values.
+// Sums are kept exact in the widest available integer type so values can be removed as easily as they are added.
+template <std::uint8_t scale, detail::SignedInteger IntType = int>
+class RollingStatistics {
+    static_assert(2 * scale <= 255, "Scale of squares must fit in std::uint8_t");
+
+    using WideType = detail::WidestInt;
+
+public:
+    using value_type = FixedPoint<scale, IntType>;
+
+    constexpr void push(const value_type value) noexcept
+    {
+        const auto raw = WideType(value.raw());
+        ++m_count;
+        m_sum = WideType(m_sum + raw);
+        m_sum_of_squares = WideType(m_sum_of_squares + raw * raw);
+    }
+
+    // Removes a value which was previously pushed
+    constexpr void pop(const value_type value) noexcept
+    {
+        assert(m_count > 0);
+        const auto raw = WideType(value.raw());
+        --m_count;
+        m_sum = WideType(m_sum - raw);
+        m_sum_of_squares = WideType(m_sum_of_squares - raw * raw);
+    }
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept
+    {
+        return m_count;
+    }
+
+    [[nodiscard]] constexpr FixedPoint<scale, WideType> sum() const noexcept
+    {
+        return FixedPoint<scale, WideType>::from_raw(m_sum);
+    }
+
+    [[nodiscard]] constexpr FixedPoint<2 * scale, WideType> sum_of_squares() const noexcept
+    {
+        return FixedPoint<2 * scale, WideType>::from_raw(m_sum_of_squares);
+    }
+
+    // Lazy expression which converts exactly to a FixedPoint (truncating) or a Rational
+    [[nodiscard]] constexpr auto mean() const noexcept
+    {
+        assert(m_count > 0);
+        return lazy(sum()) / std::int64_t(m_count);
+    }
+
+    // Population variance as a lazy expression, (sum of squares - sum * sum / count) / count
+    [[nodiscard]] constexpr auto variance() const noexcept
+    {
+        assert(m_count > 0);
+        const auto count = std::int64_t(m_count);
+        return (lazy(sum_of_squares()) - lazy(sum()) * sum() / count) / count;
+    }
+
+private:
+    std::size_t m_count { 0 };
+    WideType m_sum { 0 };
+    WideType m_sum_of_squares { 0 };
+};
+
+// Volume weighted average price of a stream of trades.
+// Sums are kept exact in the widest available integer type so trades can be removed as easily as they are added.
+template <std::uint8_t price_scale, std::uint8_t volume_scale, detail::SignedInteger IntType = int>
+class RollingVwap {
+    static_assert(price_scale + volume_scale <= 255, "Scale of notional must fit in std::uint8_t");
+
+    using WideType = detail::WidestInt;
+
+public:
+    struct Trade {
+        FixedPoint<price_scale, IntType> price;
+        FixedPoint<volume_scale, IntType> volume;
+    };
+
+    using value_type = Trade;
+
+    constexpr void push(const Trade& trade) noexcept
+    {
+        m_notional = WideType(m_notional + WideType(trade.price.raw()) * trade.volume.raw());
+        m_volume = WideType(m_volume + trade.volume.raw());
+    }
+
+    // Removes a trade which was previously pushed
+    constexpr void pop(const Trade& trade) noexcept
+    {
+        m_notional = WideType(m_notional - WideType(trade.price.raw()) * trade.volume.raw());
+        m_volume = WideType(m_volume - trade.volume.raw());
+    }
+
+    // Sum of price * volume
+    [[nodiscard]] constexpr FixedPoint<price_scale + volume_scale, WideType> notional() const noexcept
+    {
+        return FixedPoint<price_scale + volume_scale, WideType>::from_raw(m_notional);
+    }
+
+    [[nodiscard]] constexpr FixedPoint<volume_scale, WideType> volume() const noexcept
+    {
+        return FixedPoint<volume_scale, WideType>::from_raw(m_volume);
+    }
+
+    // Lazy expression which converts exactly to a FixedPoint (truncating) or a Rational
+    [[nodiscard]] constexpr auto vwap() const noexcept
+    {
+        assert(m_volume != 0);
+        return lazy(notional()) / volume();
+    }
+
+private:
+    WideType m_notional { 0 };
+    WideType m_volume { 0 };
+};
+
+// Aggregate of the most recent values of a stream, e.g. SlidingWindow<RollingStatistics<4>> or
+// SlidingWindow<RollingVwap<4, 2>>. Pushing and popping are O(1) and never allocate.
+template <typename Aggregate>
+class SlidingWindow {
+public:
+    using value_type = typename Aggregate::value_type;
+
+    // The capacity is at least one
+    explicit SlidingWindow(const std::size_t capacity)
+        : m_values(std::max(capacity, std::size_t(1)))
+    {
+    }
+
+    // Evicts the oldest value when the window is full
+    void push(const value_type& value) noexcept
+    {
+        if (m_values.full())
+            pop();
+        m_values.push_back(value);
+        m_aggregate.push(value);
+    }
+
+    // Evicts the oldest value, e.g. to expire values older than some time limit
+    void pop() noexcept
+    {
+        m_aggregate.pop(m_values.front());
+        m_values.pop_front();
+    }
+
+    [[nodiscard]] const Aggregate& aggregate() const noexcept
+    {
+        return m_aggregate;
+    }
+
+    [[nodiscard]] const RingBuffer<value_type>& values() const noexcept
+    {
+        return m_values;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return m_values.size();
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept
+    {
+        return m_values.capacity();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return m_values.empty();
+    }
+
+private:
+    RingBuffer<value_type> m_values;
+    Aggregate m_aggregate;
+};
+}
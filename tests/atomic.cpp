@@ -0,0 +1,157 @@
+#include <nira/atomic.hpp>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using nira::AtomicFixedPoint;
+using nira::FixedPoint;
+using nira::ShardedAccumulator;
+
+namespace {
+template <typename Function>
+void run_threads(const int thread_count, const Function& function)
+{
+    std::vector<std::thread> threads;
+    for (int i = 0; i < thread_count; ++i)
+        threads.emplace_back(function);
+    for (auto& thread : threads)
+        thread.join();
+}
+}
+
+TEMPLATE_TEST_CASE("AtomicFixedPoint type traits", "", std::int8_t, std::int16_t, std::int32_t, std::int64_t)
+{
+    STATIC_CHECK(sizeof(AtomicFixedPoint<1, TestType>) == sizeof(TestType));
+    STATIC_CHECK(std::is_nothrow_default_constructible_v<AtomicFixedPoint<1, TestType>>);
+    STATIC_CHECK(!std::is_copy_constructible_v<AtomicFixedPoint<1, TestType>>);
+    STATIC_CHECK(!std::is_copy_assignable_v<AtomicFixedPoint<1, TestType>>);
+    STATIC_CHECK(AtomicFixedPoint<1, TestType>::is_always_lock_free == std::atomic<TestType>::is_always_lock_free);
+}
+
+TEMPLATE_TEST_CASE("AtomicFixedPoint::AtomicFixedPoint()", "", std::int8_t, std::int16_t, std::int32_t, std::int64_t)
+{
+    const AtomicFixedPoint<1, TestType> value;
+    CHECK(value.load() == FixedPoint<1, TestType>());
+}
+
+TEMPLATE_TEST_CASE("AtomicFixedPoint::AtomicFixedPoint(FixedPoint)", "", std::int16_t, std::int32_t, std::int64_t)
+{
+    const AtomicFixedPoint<2, TestType> value(FixedPoint<2, TestType>(3, 14));
+    CHECK(value.load() == FixedPoint<2, TestType>(3, 14));
+    CHECK(FixedPoint<2, TestType>(value) == FixedPoint<2, TestType>(3, 14));
+}
+
+TEMPLATE_TEST_CASE("AtomicFixedPoint::store(FixedPoint)", "", std::int16_t, std::int32_t, std::int64_t)
+{
+    AtomicFixedPoint<2, TestType> value;
+    value.store(FixedPoint<2, TestType>(1, 50));
+    CHECK(value.load() == FixedPoint<2, TestType>(1, 50));
+    value = FixedPoint<2, TestType>(-2, 25);
+    CHECK(value.load() == FixedPoint<2, TestType>(-2, 25));
+}
+
+TEMPLATE_TEST_CASE("AtomicFixedPoint::exchange(FixedPoint)", "", std::int16_t, std::int32_t, std::int64_t)
+{
+    AtomicFixedPoint<2, TestType> value(FixedPoint<2, TestType>(1, 50));
+    CHECK(value.exchange(FixedPoint<2, TestType>(2)) == FixedPoint<2, TestType>(1, 50));
+    CHECK(value.load() == FixedPoint<2, TestType>(2));
+}
+
+TEMPLATE_TEST_CASE("AtomicFixedPoint::compare_exchange_strong(FixedPoint&, FixedPoint)",
+                   "",
+                   std::int16_t,
+                   std::int32_t,
+                   std::int64_t)
+{
+    AtomicFixedPoint<2, TestType> value(FixedPoint<2, TestType>(1, 50));
+    auto expected = FixedPoint<2, TestType>(1);
+    CHECK_FALSE(value.compare_exchange_strong(expected, FixedPoint<2, TestType>(3)));
+    CHECK(expected == FixedPoint<2, TestType>(1, 50));
+    CHECK(value.compare_exchange_strong(expected, FixedPoint<2, TestType>(3)));
+    CHECK(value.load() == FixedPoint<2, TestType>(3));
+}
+
+TEMPLATE_TEST_CASE("AtomicFixedPoint::compare_exchange_weak(FixedPoint&, FixedPoint)",
+                   "",
+                   std::int16_t,
+                   std::int32_t,
+                   std::int64_t)
+{
+    AtomicFixedPoint<2, TestType> value(FixedPoint<2, TestType>(1, 50));
+    auto expected = value.load();
+    while (!value.compare_exchange_weak(expected, expected + FixedPoint<2, TestType>(1))) { }
+    CHECK(value.load() == FixedPoint<2, TestType>(2, 50));
+}
+
+TEMPLATE_TEST_CASE("AtomicFixedPoint::fetch_add(FixedPoint)", "", std::int16_t, std::int32_t, std::int64_t)
+{
+    AtomicFixedPoint<2, TestType> value(FixedPoint<2, TestType>(1, 50));
+    CHECK(value.fetch_add(FixedPoint<2, TestType>(2, 25)) == FixedPoint<2, TestType>(1, 50));
+    CHECK(value.load() == FixedPoint<2, TestType>(3, 75));
+    CHECK((value += FixedPoint<2, TestType>(0, 25)) == FixedPoint<2, TestType>(4));
+}
+
+TEMPLATE_TEST_CASE("AtomicFixedPoint::fetch_sub(FixedPoint)", "", std::int16_t, std::int32_t, std::int64_t)
+{
+    AtomicFixedPoint<2, TestType> value(FixedPoint<2, TestType>(1, 50));
+    CHECK(value.fetch_sub(FixedPoint<2, TestType>(2, 25)) == FixedPoint<2, TestType>(1, 50));
+    CHECK(value.load() == FixedPoint<2, TestType>(-0.75));
+    CHECK((value -= FixedPoint<2, TestType>(0, 25)) == FixedPoint<2, TestType>(-1));
+}
+
+TEST_CASE("AtomicFixedPoint concurrent fetch_add")
+{
+    constexpr int thread_count = 8;
+    constexpr int iterations = 10'000;
+    AtomicFixedPoint<2> total;
+    run_threads(thread_count, [&total] {
+        for (int i = 0; i < iterations; ++i) {
+            total.fetch_add(FixedPoint<2>(0, 3), std::memory_order_relaxed);
+            total.fetch_sub(FixedPoint<2>(0, 1), std::memory_order_relaxed);
+        }
+    });
+    CHECK(total.load() == FixedPoint<2>(thread_count * iterations * 2 / 100));
+}
+
+TEST_CASE("ShardedAccumulator::ShardedAccumulator(std::size_t)")
+{
+    CHECK(ShardedAccumulator<2>().shard_count() >= 1);
+    CHECK(ShardedAccumulator<2>(0).shard_count() == 1);
+    CHECK(ShardedAccumulator<2>(1).shard_count() == 1);
+    CHECK(ShardedAccumulator<2>(5).shard_count() == 8);
+    CHECK(ShardedAccumulator<2>(16).shard_count() == 16);
+    CHECK(ShardedAccumulator<2>(4).load() == FixedPoint<2>());
+}
+
+TEMPLATE_TEST_CASE("ShardedAccumulator::operator+=(FixedPoint)", "", std::int16_t, std::int32_t, std::int64_t)
+{
+    ShardedAccumulator<2, TestType> total(4);
+    total += FixedPoint<2, TestType>(1, 50);
+    total += FixedPoint<2, TestType>(2, 25);
+    CHECK(total.load() == FixedPoint<2, TestType>(3, 75));
+}
+
+TEMPLATE_TEST_CASE("ShardedAccumulator::operator-=(FixedPoint)", "", std::int16_t, std::int32_t, std::int64_t)
+{
+    ShardedAccumulator<2, TestType> total(4);
+    total -= FixedPoint<2, TestType>(1, 50);
+    total -= FixedPoint<2, TestType>(2, 25);
+    CHECK(total.load() == FixedPoint<2, TestType>(-3, 75));
+}
+
+TEST_CASE("ShardedAccumulator concurrent writes")
+{
+    constexpr int thread_count = 8;
+    constexpr int iterations = 10'000;
+    ShardedAccumulator<2> total(4);
+    run_threads(thread_count, [&total] {
+        for (int i = 0; i < iterations; ++i) {
+            total += FixedPoint<2>(0, 3);
+            total -= FixedPoint<2>(0, 1);
+        }
+    });
+    CHECK(total.load() == FixedPoint<2>(thread_count * iterations * 2 / 100));
+}
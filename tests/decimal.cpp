@@ -0,0 +1,246 @@
+#include <nira/decimal.hpp>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <compare>
+#include <cstdint>
+#include <sstream>
+#include <type_traits>
+
+using nira::Decimal;
+using nira::FixedPoint;
+using nira::Rational;
+
+TEMPLATE_TEST_CASE("Decimal type traits", "", std::int32_t, std::int64_t)
+{
+    STATIC_CHECK(sizeof(Decimal<TestType>) == sizeof(TestType));
+    STATIC_CHECK(alignof(Decimal<TestType>) == alignof(TestType));
+    STATIC_CHECK(std::is_default_constructible_v<Decimal<TestType>>);
+    STATIC_CHECK(std::is_trivially_copy_constructible_v<Decimal<TestType>>);
+    STATIC_CHECK(std::is_trivially_copy_assignable_v<Decimal<TestType>>);
+    STATIC_CHECK(std::is_trivially_move_constructible_v<Decimal<TestType>>);
+    STATIC_CHECK(std::is_trivially_move_assignable_v<Decimal<TestType>>);
+    STATIC_CHECK(std::is_nothrow_swappable_v<Decimal<TestType>>);
+    STATIC_CHECK(std::has_unique_object_representations_v<Decimal<TestType>>);
+    STATIC_CHECK(std::totally_ordered<Decimal<TestType>>);
+    STATIC_CHECK(std::three_way_comparable<Decimal<TestType>>);
+}
+
+TEMPLATE_TEST_CASE("Decimal::Decimal()", "", std::int32_t, std::int64_t)
+{
+    STATIC_CHECK(Decimal<TestType>().coefficient() == 0);
+    STATIC_CHECK(Decimal<TestType>().exponent() == 0);
+}
+
+TEMPLATE_TEST_CASE("Decimal::Decimal(IntType, int)", "", std::int32_t, std::int64_t)
+{
+    STATIC_CHECK(Decimal<TestType>(42).coefficient() == 42);
+    STATIC_CHECK(Decimal<TestType>(42).exponent() == 0);
+    STATIC_CHECK(Decimal<TestType>(-42, -3).coefficient() == -42);
+    STATIC_CHECK(Decimal<TestType>(-42, -3).exponent() == -3);
+    STATIC_CHECK(Decimal<TestType>(7, 100).exponent() == 100);
+    STATIC_CHECK(Decimal<TestType>(7, -128).exponent() == -128);
+
+    // Coefficients too wide for the packed representation drop their least significant digits
+    constexpr auto max = Decimal<TestType>::max_coefficient;
+    STATIC_CHECK(Decimal<TestType>(TestType(max * 10)).coefficient() == max);
+    STATIC_CHECK(Decimal<TestType>(TestType(max * 10)).exponent() == 1);
+    STATIC_CHECK(Decimal<TestType>(TestType(max * 10 + 7)) == Decimal<TestType>(max, 1));
+
+    // Large exponents are traded for coefficient digits
+    STATIC_CHECK(Decimal<TestType>(5, 128).coefficient() == 50);
+    STATIC_CHECK(Decimal<TestType>(5, 128).exponent() == 127);
+
+    // Values below the smallest exponent are truncated
+    STATIC_CHECK(Decimal<TestType>(123, -130) == Decimal<TestType>(1, -128));
+    STATIC_CHECK(Decimal<TestType>(5, -200) == Decimal<TestType>());
+}
+
+TEMPLATE_TEST_CASE("Decimal::Decimal(FixedPoint)", "", std::int32_t, std::int64_t)
+{
+    STATIC_CHECK(Decimal<TestType>(FixedPoint<2>(12, 34)) == Decimal<TestType>(1'234, -2));
+    STATIC_CHECK(Decimal<TestType>(FixedPoint<2>(-12, 34)) == Decimal<TestType>(-1'234, -2));
+    STATIC_CHECK(Decimal<TestType>(FixedPoint<8, std::int64_t>(0, 1)) == Decimal<TestType>(1, -8));
+}
+
+TEMPLATE_TEST_CASE("Decimal::Decimal(Rational)", "", std::int32_t, std::int64_t)
+{
+    STATIC_CHECK(Decimal<TestType>(Rational(3)) == Decimal<TestType>(3));
+    STATIC_CHECK(Decimal<TestType>(Rational(-3, 4)) == Decimal<TestType>(-75, -2));
+    STATIC_CHECK(Decimal<TestType>(Rational(1, 1'024)) == Decimal<TestType>(9'765'625, -10));
+    STATIC_CHECK(Decimal<std::int32_t>(Rational(1, 3)) == Decimal<std::int32_t>(3'333'333, -7));
+    STATIC_CHECK(Decimal<std::int32_t>(Rational(-2, 3)) == Decimal<std::int32_t>(-6'666'666, -7));
+}
+
+TEMPLATE_TEST_CASE("Decimal::parse(std::string_view)", "", std::int32_t, std::int64_t)
+{
+    STATIC_CHECK(Decimal<TestType>::parse("0") == Decimal<TestType>());
+    STATIC_CHECK(Decimal<TestType>::parse("42") == Decimal<TestType>(42));
+    STATIC_CHECK(Decimal<TestType>::parse("+42") == Decimal<TestType>(42));
+    STATIC_CHECK(Decimal<TestType>::parse("-12.345") == Decimal<TestType>(-12'345, -3));
+    STATIC_CHECK(Decimal<TestType>::parse(".5") == Decimal<TestType>(5, -1));
+    STATIC_CHECK(Decimal<TestType>::parse("5.") == Decimal<TestType>(5));
+    STATIC_CHECK(Decimal<TestType>::parse("1e-8") == Decimal<TestType>(1, -8));
+    STATIC_CHECK(Decimal<TestType>::parse("6.02E23") == Decimal<TestType>(602, 21));
+    STATIC_CHECK(Decimal<TestType>::parse("0.00000001") == Decimal<TestType>(1, -8));
+    STATIC_CHECK(Decimal<TestType>::parse("1000000000000") == Decimal<TestType>(1, 12));
+
+    STATIC_CHECK_FALSE(Decimal<TestType>::parse("").has_value());
+    STATIC_CHECK_FALSE(Decimal<TestType>::parse("-").has_value());
+    STATIC_CHECK_FALSE(Decimal<TestType>::parse(".").has_value());
+    STATIC_CHECK_FALSE(Decimal<TestType>::parse("1.2.3").has_value());
+    STATIC_CHECK_FALSE(Decimal<TestType>::parse("12a").has_value());
+    STATIC_CHECK_FALSE(Decimal<TestType>::parse("1e").has_value());
+    STATIC_CHECK_FALSE(Decimal<TestType>::parse("1e500").has_value());
+}
+
+TEMPLATE_TEST_CASE("Decimal::operator FixedPoint()", "", std::int32_t, std::int64_t)
+{
+    STATIC_CHECK(FixedPoint<2>(Decimal<TestType>(1'234, -2)) == FixedPoint<2>(12, 34));
+    STATIC_CHECK(FixedPoint<2>(Decimal<TestType>(12, 3)) == FixedPoint<2>(12'000));
+    STATIC_CHECK(FixedPoint<2>(Decimal<TestType>(-123'456, -4)) == FixedPoint<2>(-12, 34));
+    STATIC_CHECK(FixedPoint<2>(Decimal<TestType>(1, -100)) == FixedPoint<2>());
+}
+
+TEMPLATE_TEST_CASE("Decimal::operator Rational()", "", std::int32_t, std::int64_t)
+{
+    STATIC_CHECK(Rational<int>(Decimal<TestType>(12)) == Rational(12));
+    STATIC_CHECK(Rational<int>(Decimal<TestType>(12, 2)) == Rational(1'200));
+    STATIC_CHECK(Rational<int>(Decimal<TestType>(-75, -2)) == Rational(-3, 4));
+}
+
+TEST_CASE("Decimal::operator Rational() with a coefficient wider than the Rational")
+{
+    STATIC_CHECK(Rational<int>(Decimal<>(3'000'000'000, -1)) == Rational(300'000'000));
+    STATIC_CHECK(Rational<int>(Decimal<>(-25'000'000'000, -10)) == Rational(-5, 2));
+    STATIC_CHECK(Rational<std::int8_t>(Decimal<>(1'000, -3)) == Rational<std::int8_t>(1));
+}
+
+TEMPLATE_TEST_CASE("Decimal::operator-()", "", std::int32_t, std::int64_t)
+{
+    STATIC_CHECK(-Decimal<TestType>(2) == Decimal<TestType>(-2));
+    STATIC_CHECK(-Decimal<TestType>(-42, -5) == Decimal<TestType>(42, -5));
+}
+
+TEMPLATE_TEST_CASE("Decimal::operator+(const Decimal&)", "", std::int32_t, std::int64_t)
+{
+    STATIC_CHECK(Decimal<TestType>(1) + Decimal<TestType>(2) == Decimal<TestType>(3));
+    STATIC_CHECK(Decimal<TestType>(125, -2) + Decimal<TestType>(5, -1) == Decimal<TestType>(175, -2));
+    STATIC_CHECK(Decimal<TestType>(3, 2) + Decimal<TestType>(-25, -1) == Decimal<TestType>(2'975, -1));
+
+    // Operands which differ by more than the available precision keep the larger magnitude
+    STATIC_CHECK(Decimal<TestType>(1, 12) + Decimal<TestType>(1, -8) == Decimal<TestType>(1, 12));
+    STATIC_CHECK(Decimal<TestType>(1, -8) + Decimal<TestType>(1, 12) == Decimal<TestType>(1, 12));
+
+    constexpr auto max = Decimal<TestType>::max_coefficient;
+    STATIC_CHECK(Decimal<TestType>(max) + Decimal<TestType>(max) == Decimal<TestType>(TestType(max * 2)));
+}
+
+TEMPLATE_TEST_CASE("Decimal::operator+=(const Decimal&)", "", std::int32_t, std::int64_t)
+{
+    Decimal<TestType> value(10, -1);
+    value += Decimal<TestType>(25, -2);
+    CHECK(value == Decimal<TestType>(125, -2));
+}
+
+TEMPLATE_TEST_CASE("Decimal::operator-(const Decimal&)", "", std::int32_t, std::int64_t)
+{
+    STATIC_CHECK(Decimal<TestType>(1) - Decimal<TestType>(2) == Decimal<TestType>(-1));
+    STATIC_CHECK(Decimal<TestType>(125, -2) - Decimal<TestType>(5, -1) == Decimal<TestType>(75, -2));
+}
+
+TEMPLATE_TEST_CASE("Decimal::operator-=(const Decimal&)", "", std::int32_t, std::int64_t)
+{
+    Decimal<TestType> value(10, -1);
+    value -= Decimal<TestType>(25, -2);
+    CHECK(value == Decimal<TestType>(75, -2));
+}
+
+TEMPLATE_TEST_CASE("Decimal::operator*(const Decimal&)", "", std::int32_t, std::int64_t)
+{
+    STATIC_CHECK(Decimal<TestType>() * Decimal<TestType>(4) == Decimal<TestType>());
+    STATIC_CHECK(Decimal<TestType>(125, -2) * Decimal<TestType>(4) == Decimal<TestType>(5));
+    STATIC_CHECK(Decimal<TestType>(-3, -8) * Decimal<TestType>(2, 12) == Decimal<TestType>(-6, 4));
+    STATIC_CHECK(Decimal<TestType>(1'000, -3) * Decimal<TestType>(1'000, -3) == Decimal<TestType>(1));
+
+    // Products wider than the coefficient are exact when only trailing zeros are dropped
+    STATIC_CHECK(Decimal<TestType>(4'000, 0) * Decimal<TestType>(5'000, 0) == Decimal<TestType>(2, 7));
+}
+
+TEMPLATE_TEST_CASE("Decimal::operator*=(const Decimal&)", "", std::int32_t, std::int64_t)
+{
+    Decimal<TestType> value(15, -1);
+    value *= Decimal<TestType>(15, -1);
+    CHECK(value == Decimal<TestType>(225, -2));
+}
+
+TEMPLATE_TEST_CASE("Decimal::operator/(const Decimal&)", "", std::int32_t, std::int64_t)
+{
+    STATIC_CHECK(Decimal<TestType>() / Decimal<TestType>(4) == Decimal<TestType>());
+    STATIC_CHECK(Decimal<TestType>(5) / Decimal<TestType>(4) == Decimal<TestType>(125, -2));
+    STATIC_CHECK(Decimal<TestType>(-6, 4) / Decimal<TestType>(2, 12) == Decimal<TestType>(-3, -8));
+    STATIC_CHECK(Decimal<std::int32_t>(1) / Decimal<std::int32_t>(3) == Decimal<std::int32_t>(3'333'333, -7));
+
+    // Exact quotients are not padded with trailing zeros
+    constexpr auto half = Decimal<TestType>(1) / Decimal<TestType>(2);
+    STATIC_CHECK(half.coefficient() == 5);
+    STATIC_CHECK(half.exponent() == -1);
+    constexpr auto quotient = Decimal<TestType>(5) / Decimal<TestType>(4);
+    STATIC_CHECK(quotient.coefficient() == 125);
+    STATIC_CHECK(quotient.exponent() == -2);
+    constexpr auto whole = Decimal<TestType>(100) / Decimal<TestType>(5);
+    STATIC_CHECK(whole.coefficient() == 20);
+    STATIC_CHECK(whole.exponent() == 0);
+    constexpr auto third = Decimal<std::int32_t>(1) / Decimal<std::int32_t>(3);
+    STATIC_CHECK(third.coefficient() == 3'333'333);
+    STATIC_CHECK(third.exponent() == -7);
+}
+
+TEMPLATE_TEST_CASE("Decimal::operator/=(const Decimal&)", "", std::int32_t, std::int64_t)
+{
+    Decimal<TestType> value(225, -2);
+    value /= Decimal<TestType>(15, -1);
+    CHECK(value == Decimal<TestType>(15, -1));
+}
+
+TEMPLATE_TEST_CASE("Decimal::operator==(const Decimal&)", "", std::int32_t, std::int64_t)
+{
+    STATIC_CHECK(Decimal<TestType>() == Decimal<TestType>(0, 5));
+    STATIC_CHECK(Decimal<TestType>(1) == Decimal<TestType>(10, -1));
+    STATIC_CHECK(Decimal<TestType>(-5, 2) == Decimal<TestType>(-500));
+
+    STATIC_CHECK_FALSE(Decimal<TestType>(1) == Decimal<TestType>(1, -1));
+    STATIC_CHECK_FALSE(Decimal<TestType>(1) == Decimal<TestType>(-1));
+}
+
+TEMPLATE_TEST_CASE("Decimal::operator<=>(const Decimal&)", "", std::int32_t, std::int64_t)
+{
+    STATIC_CHECK(std::is_same_v<decltype(Decimal<TestType>() <=> Decimal<TestType>()), std::weak_ordering>);
+    STATIC_CHECK(Decimal<TestType>(1) < Decimal<TestType>(2));
+    STATIC_CHECK(Decimal<TestType>(9, -1) < Decimal<TestType>(1));
+    STATIC_CHECK(Decimal<TestType>(-1) < Decimal<TestType>(1, -100));
+    STATIC_CHECK(Decimal<TestType>(1, -100) < Decimal<TestType>(1, 100));
+    STATIC_CHECK(Decimal<TestType>(-1, 100) < Decimal<TestType>(-1, -100));
+    STATIC_CHECK(Decimal<TestType>() < Decimal<TestType>(1, -128));
+    STATIC_CHECK(Decimal<TestType>(10, -1) <= Decimal<TestType>(1));
+    STATIC_CHECK(Decimal<TestType>(1, 12) > Decimal<TestType>(999'999, -8));
+    STATIC_CHECK(Decimal<TestType>(1, 12) >= Decimal<TestType>(1'000, 9));
+    STATIC_CHECK(Decimal<TestType>(12, 60) == Decimal<TestType>(12'000, 57));
+    STATIC_CHECK(Decimal<TestType>(12, 60) < Decimal<TestType>(12'001, 57));
+    STATIC_CHECK(Decimal<TestType>(-12, 60) > Decimal<TestType>(-12'001, 57));
+}
+
+TEST_CASE("Decimal operator<<")
+{
+    const auto to_string = [](const auto& value) {
+        std::ostringstream out;
+        out << value;
+        return out.str();
+    };
+    CHECK(to_string(Decimal()) == "0");
+    CHECK(to_string(Decimal(42)) == "42");
+    CHECK(to_string(Decimal(42, 3)) == "42000");
+    CHECK(to_string(Decimal(-12'345, -2)) == "-123.45");
+    CHECK(to_string(Decimal(5, -3)) == "0.005");
+    CHECK(to_string(Decimal(-5, -1)) == "-0.5");
+    CHECK(to_string(*Decimal<>::parse("0.00012300")) == "0.00012300");
+}
@@ -1,7 +1,10 @@
 #include <nira/fixed_point.hpp>
 
 #include <catch2/catch_template_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <numbers>
+#include <sstream>
 #include <type_traits>
 
 using nira::FixedPoint;
@@ -82,6 +85,36 @@ TEST_CASE("FixedPoint::FixedPoint(std::floating_point)", )
     STATIC_CHECK(debt.fractional() == 56);
 }
 
+TEST_CASE("FixedPoint::FixedPoint(const FixedPoint<other_scale, OtherInt>&)")
+{
+    STATIC_CHECK(FixedPoint<4>(FixedPoint<2>(1, 25)) == FixedPoint<4>(1, 2'500));
+    STATIC_CHECK(FixedPoint<2>(FixedPoint<4>(1, 2'345)) == FixedPoint<2>(1, 23));
+    STATIC_CHECK(FixedPoint<2>(FixedPoint<4>(-1, 2'345)) == FixedPoint<2>(-1, 23));
+    STATIC_CHECK(FixedPoint<2, std::int16_t>(FixedPoint<2, std::int64_t>(12, 34))
+                 == FixedPoint<2, std::int16_t>(12, 34));
+    STATIC_CHECK(FixedPoint<8, std::int64_t>(FixedPoint<2, std::int8_t>(1, 5))
+                 == FixedPoint<8, std::int64_t>(1, 5'000'000));
+    STATIC_CHECK(FixedPoint<1, std::int8_t>(FixedPoint<4, std::int64_t>(12, 3'456))
+                 == FixedPoint<1, std::int8_t>(12, 3));
+
+    STATIC_CHECK(!std::is_convertible_v<FixedPoint<2>, FixedPoint<4>>);
+    STATIC_CHECK(!std::is_convertible_v<FixedPoint<4>, FixedPoint<2>>);
+}
+
+TEMPLATE_TEST_CASE("FixedPoint::from_raw(IntType)", "", std::int8_t, std::int16_t, std::int32_t, std::int64_t)
+{
+    STATIC_CHECK(FixedPoint<1, TestType>::from_raw(0) == FixedPoint<1, TestType>());
+    STATIC_CHECK(FixedPoint<1, TestType>::from_raw(15) == FixedPoint<1, TestType>(1, 5));
+    STATIC_CHECK(FixedPoint<2, TestType>::from_raw(-105) == FixedPoint<2, TestType>(-1, 5));
+}
+
+TEMPLATE_TEST_CASE("FixedPoint::raw()", "", std::int8_t, std::int16_t, std::int32_t, std::int64_t)
+{
+    STATIC_CHECK(FixedPoint<1, TestType>().raw() == 0);
+    STATIC_CHECK(FixedPoint<1, TestType>(1, 5).raw() == 15);
+    STATIC_CHECK(FixedPoint<2, TestType>(-1, 5).raw() == -105);
+}
+
 TEMPLATE_TEST_CASE("FixedPoint::operator-()", "", std::int8_t, std::int16_t, std::int32_t, std::int64_t)
 {
     STATIC_CHECK(-FixedPoint<1, TestType>(2) == FixedPoint<1, TestType>(-2));
@@ -135,6 +168,69 @@ TEMPLATE_TEST_CASE("FixedPoint::operator*=(FixedPoint)", "", std::int16_t, std::
     CHECK(fixed == FixedPoint<2>(89, 27));
 }
 
+TEST_CASE("FixedPoint::operator*(const FixedPoint<other_scale, OtherInt>&)")
+{
+    constexpr auto product = FixedPoint<2, std::int32_t>(12, 34) * FixedPoint<4, std::int32_t>(0, 5);
+    STATIC_CHECK(std::is_same_v<decltype(product), const FixedPoint<6, std::int64_t>>);
+    STATIC_CHECK(product == FixedPoint<6, std::int64_t>(0, 6'170));
+
+    constexpr auto mixed = FixedPoint<1, std::int8_t>(-1, 5) * FixedPoint<1, std::int16_t>(2, 5);
+    STATIC_CHECK(std::is_same_v<decltype(mixed), const FixedPoint<2, std::int32_t>>);
+    STATIC_CHECK(mixed == FixedPoint<2, std::int32_t>(-3, 75));
+
+    // Would overflow std::int32_t if rescaled after each step
+    constexpr FixedPoint<2, std::int32_t> price(21'474, 83);
+    constexpr FixedPoint<1, std::int32_t> quantity(1'000);
+    constexpr FixedPoint<4, std::int32_t> rate(1, 2'345);
+    constexpr auto notional = price * quantity;
+    STATIC_CHECK(notional == FixedPoint<3, std::int64_t>(21'474'830));
+    STATIC_CHECK(FixedPoint<2, std::int64_t>(notional * rate) == FixedPoint<2, std::int64_t>(26'510'677, 63));
+}
+
+TEMPLATE_TEST_CASE("FixedPoint::operator*(IntType)", "", std::int16_t, std::int32_t, std::int64_t)
+{
+    STATIC_CHECK(FixedPoint<2, TestType>() * TestType(3) == FixedPoint<2, TestType>());
+    STATIC_CHECK(FixedPoint<2, TestType>(2, 5) * TestType(3) == FixedPoint<2, TestType>(6, 15));
+    STATIC_CHECK(FixedPoint<2, TestType>(2, 5) * TestType(-3) == FixedPoint<2, TestType>(-6, 15));
+    STATIC_CHECK(TestType(3) * FixedPoint<2, TestType>(2, 5) == FixedPoint<2, TestType>(6, 15));
+
+    // Floating point operands do not implicitly convert to an integer
+    STATIC_CHECK(!requires(FixedPoint<2, TestType> fixed) { fixed * 2.5; });
+    STATIC_CHECK(!requires(FixedPoint<2, TestType> fixed) { 2.5 * fixed; });
+    STATIC_CHECK(!requires(FixedPoint<2, TestType> fixed) { fixed *= 2.5; });
+
+    // Neither do integers which would be narrowed
+    STATIC_CHECK(!requires(FixedPoint<2, TestType> fixed) { fixed * std::size_t(3); });
+    STATIC_CHECK(!requires(FixedPoint<2, TestType> fixed) { fixed * true; });
+    using Wider = nira::detail::wider_t<TestType>;
+    STATIC_CHECK((sizeof(Wider) == sizeof(TestType) || !requires(FixedPoint<2, TestType> fixed, Wider value) {
+        fixed * value;
+    }));
+}
+
+TEMPLATE_TEST_CASE("FixedPoint::operator*=(IntType)", "", std::int16_t, std::int32_t, std::int64_t)
+{
+    FixedPoint<2, TestType> fixed(1, 25);
+    fixed *= TestType(4);
+    CHECK(fixed == FixedPoint<2, TestType>(5));
+}
+
+TEMPLATE_TEST_CASE("FixedPoint::operator*(const Rational&)", "", std::int16_t, std::int32_t, std::int64_t)
+{
+    using nira::Rational;
+    STATIC_CHECK(FixedPoint<2, TestType>(3) * Rational<TestType>(1, 3) == FixedPoint<2, TestType>(1));
+    STATIC_CHECK(FixedPoint<2, TestType>(1) * Rational<TestType>(2, 3) == FixedPoint<2, TestType>(0, 66));
+    STATIC_CHECK(FixedPoint<2, TestType>(1) * Rational<TestType>(-2, 3) == -FixedPoint<2, TestType>(0, 66));
+    STATIC_CHECK(Rational<TestType>(1, 4) * FixedPoint<2, TestType>(2) == FixedPoint<2, TestType>(0, 50));
+}
+
+TEMPLATE_TEST_CASE("FixedPoint::operator*=(const Rational&)", "", std::int16_t, std::int32_t, std::int64_t)
+{
+    FixedPoint<2, TestType> fixed(1, 50);
+    fixed *= nira::Rational<TestType>(5, 3);
+    CHECK(fixed == FixedPoint<2, TestType>(2, 50));
+}
+
 TEMPLATE_TEST_CASE("FixedPoint::operator/(FixedPoint)", "", std::int16_t, std::int32_t, std::int64_t)
 {
     STATIC_CHECK(FixedPoint<1>() / FixedPoint<1>(1) == FixedPoint<1>());
@@ -152,6 +248,40 @@ TEMPLATE_TEST_CASE("FixedPoint::operator/=(FixedPoint)", "", std::int8_t, std::i
     CHECK(fixed == FixedPoint<1>(0, 6));
 }
 
+TEMPLATE_TEST_CASE("FixedPoint::operator/(IntType)", "", std::int16_t, std::int32_t, std::int64_t)
+{
+    STATIC_CHECK(FixedPoint<2, TestType>() / TestType(3) == FixedPoint<2, TestType>());
+    STATIC_CHECK(FixedPoint<2, TestType>(6, 15) / TestType(3) == FixedPoint<2, TestType>(2, 5));
+    STATIC_CHECK(FixedPoint<2, TestType>(1) / TestType(3) == FixedPoint<2, TestType>(0, 33));
+    STATIC_CHECK(FixedPoint<2, TestType>(1) / TestType(-3) == -FixedPoint<2, TestType>(0, 33));
+    STATIC_CHECK(!requires(FixedPoint<2, TestType> fixed) { fixed / 2.5; });
+    STATIC_CHECK(!requires(FixedPoint<2, TestType> fixed) { fixed /= 2.5; });
+    STATIC_CHECK(!requires(FixedPoint<2, TestType> fixed) { fixed / std::size_t(3); });
+    STATIC_CHECK(!requires(FixedPoint<2, TestType> fixed) { fixed / true; });
+}
+
+TEMPLATE_TEST_CASE("FixedPoint::operator/=(IntType)", "", std::int16_t, std::int32_t, std::int64_t)
+{
+    FixedPoint<2, TestType> fixed(5);
+    fixed /= TestType(4);
+    CHECK(fixed == FixedPoint<2, TestType>(1, 25));
+}
+
+TEMPLATE_TEST_CASE("FixedPoint::operator/(const Rational&)", "", std::int16_t, std::int32_t, std::int64_t)
+{
+    using nira::Rational;
+    STATIC_CHECK(FixedPoint<2, TestType>(1) / Rational<TestType>(1, 3) == FixedPoint<2, TestType>(3));
+    STATIC_CHECK(FixedPoint<2, TestType>(1) / Rational<TestType>(3, 2) == FixedPoint<2, TestType>(0, 66));
+    STATIC_CHECK(FixedPoint<2, TestType>(1) / Rational<TestType>(-3, 2) == -FixedPoint<2, TestType>(0, 66));
+}
+
+TEMPLATE_TEST_CASE("FixedPoint::operator/=(const Rational&)", "", std::int16_t, std::int32_t, std::int64_t)
+{
+    FixedPoint<2, TestType> fixed(2, 50);
+    fixed /= nira::Rational<TestType>(5, 3);
+    CHECK(fixed == FixedPoint<2, TestType>(1, 50));
+}
+
 TEMPLATE_TEST_CASE(
     "FixedPoint::operator==(const FixedPoint&)", "", std::int8_t, std::int16_t, std::int32_t, std::int64_t)
 {
@@ -227,3 +357,17 @@ TEMPLATE_TEST_CASE(
     STATIC_CHECK_FALSE(FixedPoint<1, TestType>() >= FixedPoint<1, TestType>(1));
     STATIC_CHECK_FALSE(FixedPoint<1, TestType>() >= FixedPoint<1, TestType>(1.5));
 }
+
+TEST_CASE("FixedPoint operator<<")
+{
+    const auto to_string = [](const auto& value) {
+        std::ostringstream out;
+        out << value;
+        return out.str();
+    };
+    CHECK(to_string(FixedPoint<2>(12, 34)) == "12.34");
+    CHECK(to_string(FixedPoint<3, std::int8_t>(0, 5)) == "0.005");
+    CHECK(to_string(FixedPoint<4, std::int64_t>(-123, 4'567)) == "-123.4567");
+    CHECK(to_string(FixedPoint<8, std::int64_t>(123'456, 7) * FixedPoint<2, std::int64_t>(1'000))
+          == "123456000.0000700000");
+}
@@ -0,0 +1,92 @@
+#include <nira/lazy.hpp>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <cstdint>
+
+using nira::FixedPoint;
+using nira::lazy;
+using nira::Rational;
+
+TEMPLATE_TEST_CASE("lazy(FixedPoint)", "", std::int8_t, std::int16_t, std::int32_t, std::int64_t)
+{
+    STATIC_CHECK(FixedPoint<1, TestType>(lazy(FixedPoint<1, TestType>(1, 5))) == FixedPoint<1, TestType>(1, 5));
+    STATIC_CHECK(FixedPoint<2, TestType>(lazy(FixedPoint<1, TestType>(0, 5))) == FixedPoint<2, TestType>(0, 50));
+    STATIC_CHECK(FixedPoint<1, TestType>(lazy(FixedPoint<2, TestType>(0, 55))) == FixedPoint<1, TestType>(0, 5));
+    STATIC_CHECK(FixedPoint<1, TestType>(-lazy(FixedPoint<1, TestType>(1, 5))) == FixedPoint<1, TestType>(-1, 5));
+}
+
+TEMPLATE_TEST_CASE("Lazy FixedPoint arithmetic", "", std::int8_t, std::int16_t, std::int32_t, std::int64_t)
+{
+    using Fixed = FixedPoint<1, TestType>;
+    STATIC_CHECK(Fixed(lazy(Fixed(1, 5)) + Fixed(2, 1)) == Fixed(1, 5) + Fixed(2, 1));
+    STATIC_CHECK(Fixed(lazy(Fixed(1, 5)) - Fixed(2, 1)) == Fixed(1, 5) - Fixed(2, 1));
+    STATIC_CHECK(Fixed(lazy(Fixed(1, 5)) * Fixed(2, 1)) == Fixed(3, 1));
+    STATIC_CHECK(Fixed(lazy(Fixed(1, 5)) / Fixed(2, 1)) == Fixed(0, 7));
+    STATIC_CHECK(Fixed(Fixed(1, 5) * lazy(Fixed(2, 1))) == Fixed(3, 1));
+    STATIC_CHECK(Fixed(lazy(Fixed(1, 5)) * 3) == Fixed(4, 5));
+    STATIC_CHECK(Fixed(lazy(Fixed(1, 5)) * Fixed(2) / Fixed(3)) == Fixed(1));
+}
+
+TEST_CASE("Lazy FixedPoint expressions round once")
+{
+    using Fixed = FixedPoint<2, std::int32_t>;
+
+    // Eager evaluation truncates 1/3 to 0.33 before multiplying
+    STATIC_CHECK(Fixed(1) / Fixed(3) * Fixed(3) == Fixed(0, 99));
+    STATIC_CHECK(Fixed(lazy(Fixed(1)) / Fixed(3) * Fixed(3)) == Fixed(1));
+
+    // Eager evaluation overflows the 32-bit intermediate product
+    constexpr Fixed price(12'345, 67);
+    constexpr Fixed quantity(1'000);
+    constexpr Fixed rate(4);
+    STATIC_CHECK(Fixed(lazy(price) * quantity / rate) == Fixed(3'086'417, 50));
+
+    // Mixed scales are aligned without losing digits
+    STATIC_CHECK(FixedPoint<4>(lazy(Fixed(1, 25)) + FixedPoint<4>(0, 5)) == FixedPoint<4>(1, 2505));
+    STATIC_CHECK(FixedPoint<4>(lazy(Fixed(1, 25)) * FixedPoint<4>(0, 5)) == FixedPoint<4>(0, 6));
+    STATIC_CHECK(FixedPoint<2>(lazy(FixedPoint<4>(1, 2345)) - Fixed(0, 1)) == Fixed(1, 22));
+}
+
+TEST_CASE("Lazy FixedPoint compound assignment")
+{
+    FixedPoint<2> total(10);
+    total += lazy(FixedPoint<2>(2, 50)) * 4;
+    CHECK(total == FixedPoint<2>(20));
+    total = lazy(total) / FixedPoint<2>(3) * FixedPoint<2>(3);
+    CHECK(total == FixedPoint<2>(20));
+    total *= lazy(FixedPoint<2>(1, 50)) * 2;
+    CHECK(total == FixedPoint<2>(60));
+    total /= lazy(FixedPoint<2>(1, 50)) * 2;
+    CHECK(total == FixedPoint<2>(20));
+}
+
+TEMPLATE_TEST_CASE("Lazy Rational arithmetic", "", std::int8_t, std::int16_t, std::int32_t, std::int64_t)
+{
+    STATIC_CHECK(Rational<TestType>(lazy(Rational<TestType>(3, 4))) == Rational<TestType>(3, 4));
+    STATIC_CHECK(Rational<TestType>(-lazy(Rational<TestType>(3, 4))) == Rational<TestType>(-3, 4));
+    STATIC_CHECK(Rational<TestType>(lazy(Rational<TestType>(1, 3)) + Rational<TestType>(1, 6))
+                 == Rational<TestType>(1, 2));
+    STATIC_CHECK(Rational<TestType>(lazy(Rational<TestType>(4, 5)) - Rational<TestType>(8, 3))
+                 == Rational<TestType>(-28, 15));
+    STATIC_CHECK(Rational<TestType>(lazy(Rational<TestType>(3, 5)) * Rational<TestType>(7, 11))
+                 == Rational<TestType>(21, 55));
+    STATIC_CHECK(Rational<TestType>(lazy(Rational<TestType>(3, 5)) / Rational<TestType>(7, 11))
+                 == Rational<TestType>(33, 35));
+    STATIC_CHECK(Rational<TestType>(lazy(Rational<TestType>(3, 5)) / Rational<TestType>(-7, 11))
+                 == Rational<TestType>(-33, 35));
+}
+
+TEST_CASE("Lazy Rational expressions reduce once")
+{
+    // Eager evaluation overflows the 8-bit numerator when multiplying 100/9 by 9/100
+    using Small = Rational<std::int8_t>;
+    STATIC_CHECK(Small(lazy(Small(10, 3)) * Small(10, 3) * Small(9, 100)) == Small(1));
+    STATIC_CHECK(Small(lazy(Small(1, 7)) + Small(1, 11) - Small(1, 7) - Small(1, 11)) == Small(0));
+}
+
+TEST_CASE("Lazy mixed FixedPoint and Rational")
+{
+    STATIC_CHECK(FixedPoint<2>(lazy(FixedPoint<2>(3)) * Rational(1, 3)) == FixedPoint<2>(1));
+    STATIC_CHECK(Rational<int>(lazy(FixedPoint<2>(1, 50)) * Rational(2, 3)) == Rational(1));
+    STATIC_CHECK(Rational<int>(lazy(FixedPoint<2>(1, 50)) / FixedPoint<1>(0, 5)) == Rational(3));
+}
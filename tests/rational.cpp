@@ -66,6 +66,30 @@ TEST_CASE("Rational::Rational(const Rational<U>&)")
     STATIC_CHECK(Rational<std::int64_t>(rational_i64) == rational_i64); // Copy ctor
 }
 
+TEST_CASE("Rational<WidestInt>")
+{
+    using WidestInt = nira::detail::WidestInt;
+    STATIC_CHECK(Rational<WidestInt>(6, 4) == Rational<WidestInt>(3, 2));
+    STATIC_CHECK(Rational<WidestInt>(1, 2) + Rational<WidestInt>(1, 3) == Rational<WidestInt>(5, 6));
+    STATIC_CHECK(Rational<WidestInt>(2, 3) * WidestInt(3) == Rational<WidestInt>(2));
+    STATIC_CHECK(Rational<WidestInt>(2, 3) / WidestInt(4) == Rational<WidestInt>(1, 6));
+    STATIC_CHECK(Rational<WidestInt>(1, 3) < Rational<WidestInt>(1, 2));
+}
+
+TEMPLATE_TEST_CASE("Rational::numerator()", "", std::int8_t, std::int16_t, std::int32_t, std::int64_t)
+{
+    STATIC_CHECK(Rational<TestType>().numerator() == 0);
+    STATIC_CHECK(Rational<TestType>(10, 4).numerator() == 5);
+    STATIC_CHECK(Rational<TestType>(-10, 4).numerator() == -5);
+}
+
+TEMPLATE_TEST_CASE("Rational::denominator()", "", std::int8_t, std::int16_t, std::int32_t, std::int64_t)
+{
+    STATIC_CHECK(Rational<TestType>().denominator() == 1);
+    STATIC_CHECK(Rational<TestType>(10, 4).denominator() == 2);
+    STATIC_CHECK(Rational<TestType>(-10, 4).denominator() == 2);
+}
+
 TEMPLATE_TEST_CASE("Rational::real()", "", std::int8_t, std::int16_t, std::int32_t, std::int64_t)
 {
     STATIC_CHECK(Rational<TestType>(-1).real() == -1);
@@ -96,6 +120,20 @@ TEMPLATE_TEST_CASE("Rational::operator+=(const Rational&)", "", std::int8_t, std
     CHECK(value == Rational<TestType>(103, 21));
 }
 
+TEMPLATE_TEST_CASE("Rational::operator+(IntType)", "", std::int8_t, std::int16_t, std::int32_t, std::int64_t)
+{
+    STATIC_CHECK(Rational<TestType>(1, 3) + TestType(2) == Rational<TestType>(7, 3));
+    STATIC_CHECK(Rational<TestType>(1, 3) + TestType(-1) == Rational<TestType>(-2, 3));
+    STATIC_CHECK(TestType(2) + Rational<TestType>(-1, 3) == Rational<TestType>(5, 3));
+}
+
+TEMPLATE_TEST_CASE("Rational::operator+=(IntType)", "", std::int8_t, std::int16_t, std::int32_t, std::int64_t)
+{
+    Rational<TestType> value(10, 3);
+    value += TestType(2);
+    CHECK(value == Rational<TestType>(16, 3));
+}
+
 TEMPLATE_TEST_CASE("Rational::operator-(const Rational&)", "", std::int8_t, std::int16_t, std::int32_t, std::int64_t)
 {
     STATIC_CHECK(Rational<TestType>(1) - Rational<TestType>(2) == Rational<TestType>(-1));
@@ -111,6 +149,20 @@ TEMPLATE_TEST_CASE("Rational::operator-=(const Rational&)", "", std::int8_t, std
     CHECK(value == Rational<TestType>(37, 21));
 }
 
+TEMPLATE_TEST_CASE("Rational::operator-(IntType)", "", std::int8_t, std::int16_t, std::int32_t, std::int64_t)
+{
+    STATIC_CHECK(Rational<TestType>(1, 3) - TestType(2) == Rational<TestType>(-5, 3));
+    STATIC_CHECK(Rational<TestType>(7, 3) - TestType(2) == Rational<TestType>(1, 3));
+    STATIC_CHECK(Rational<TestType>(6) - TestType(6) == Rational<TestType>());
+}
+
+TEMPLATE_TEST_CASE("Rational::operator-=(IntType)", "", std::int8_t, std::int16_t, std::int32_t, std::int64_t)
+{
+    Rational<TestType> value(10, 3);
+    value -= TestType(2);
+    CHECK(value == Rational<TestType>(4, 3));
+}
+
 TEMPLATE_TEST_CASE("Rational::operator*(const Rational&)", "", std::int8_t, std::int16_t, std::int32_t, std::int64_t)
 {
     STATIC_CHECK(Rational<TestType>() * Rational<TestType>() == Rational<TestType>());
@@ -125,6 +177,24 @@ TEMPLATE_TEST_CASE("Rational::operator*=(const Rational&)", "", std::int8_t, std
     CHECK(value == Rational<TestType>(55, 21));
 }
 
+TEMPLATE_TEST_CASE("Rational::operator*(IntType)", "", std::int8_t, std::int16_t, std::int32_t, std::int64_t)
+{
+    STATIC_CHECK(Rational<TestType>() * TestType(4) == Rational<TestType>());
+    STATIC_CHECK(Rational<TestType>(3, 5) * TestType(0) == Rational<TestType>());
+    STATIC_CHECK(Rational<TestType>(3, 5) * TestType(2) == Rational<TestType>(6, 5));
+    STATIC_CHECK(Rational<TestType>(3, 10) * TestType(4) == Rational<TestType>(6, 5));
+    STATIC_CHECK(Rational<TestType>(3, 10) * TestType(-5) == Rational<TestType>(-3, 2));
+    STATIC_CHECK(Rational<TestType>(3, -10) * TestType(-5) == Rational<TestType>(-15, -10));
+    STATIC_CHECK(TestType(4) * Rational<TestType>(3, 10) == Rational<TestType>(6, 5));
+}
+
+TEMPLATE_TEST_CASE("Rational::operator*=(IntType)", "", std::int8_t, std::int16_t, std::int32_t, std::int64_t)
+{
+    Rational<TestType> value(5, 6);
+    value *= TestType(3);
+    CHECK(value == Rational<TestType>(5, 2));
+}
+
 TEMPLATE_TEST_CASE("Rational::operator/(const Rational&)", "", std::int8_t, std::int16_t, std::int32_t, std::int64_t)
 {
     STATIC_CHECK(Rational<TestType>() / Rational<TestType>(1) == Rational<TestType>());
@@ -139,6 +209,22 @@ TEMPLATE_TEST_CASE("Rational::operator/=(const Rational&)", "", std::int8_t, std
     CHECK(value == Rational<TestType>(35, 33));
 }
 
+TEMPLATE_TEST_CASE("Rational::operator/(IntType)", "", std::int8_t, std::int16_t, std::int32_t, std::int64_t)
+{
+    STATIC_CHECK(Rational<TestType>() / TestType(4) == Rational<TestType>());
+    STATIC_CHECK(Rational<TestType>(3, 5) / TestType(2) == Rational<TestType>(3, 10));
+    STATIC_CHECK(Rational<TestType>(6, 5) / TestType(4) == Rational<TestType>(3, 10));
+    STATIC_CHECK(Rational<TestType>(6, 5) / TestType(-4) == Rational<TestType>(6, 5) / Rational<TestType>(-4));
+    STATIC_CHECK(Rational<TestType>(-6, 5) / TestType(-4) == Rational<TestType>(-6, -20));
+}
+
+TEMPLATE_TEST_CASE("Rational::operator/=(IntType)", "", std::int8_t, std::int16_t, std::int32_t, std::int64_t)
+{
+    Rational<TestType> value(5, 2);
+    value /= TestType(3);
+    CHECK(value == Rational<TestType>(5, 6));
+}
+
 TEMPLATE_TEST_CASE("Rational::operator==(const Rational&)", "", std::int8_t, std::int16_t, std::int32_t, std::int64_t)
 {
     STATIC_CHECK(Rational<TestType>(1) == Rational<TestType>(1));
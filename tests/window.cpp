@@ -0,0 +1,180 @@
+#include <nira/window.hpp>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <cstdint>
+#include <type_traits>
+
+using nira::FixedPoint;
+using nira::Rational;
+using nira::RingBuffer;
+using nira::RollingStatistics;
+using nira::RollingVwap;
+using nira::SlidingWindow;
+
+namespace {
+template <typename Aggregate, typename... Values>
+constexpr Aggregate make_aggregate(const Values&... values)
+{
+    Aggregate aggregate;
+    (aggregate.push(values), ...);
+    return aggregate;
+}
+}
+
+TEST_CASE("RingBuffer type traits")
+{
+    STATIC_CHECK(!std::is_copy_constructible_v<RingBuffer<int>>);
+    STATIC_CHECK(std::is_nothrow_move_constructible_v<RingBuffer<int>>);
+}
+
+TEST_CASE("RingBuffer::RingBuffer(std::size_t)")
+{
+    const RingBuffer<int> buffer(3);
+    CHECK(buffer.capacity() == 3);
+    CHECK(buffer.size() == 0);
+    CHECK(buffer.empty());
+    CHECK(!buffer.full());
+}
+
+TEST_CASE("RingBuffer::push_back(const T&)")
+{
+    RingBuffer<int> buffer(3);
+    buffer.push_back(1);
+    buffer.push_back(2);
+    buffer.push_back(3);
+    CHECK(buffer.full());
+    CHECK(buffer.front() == 1);
+    CHECK(buffer.back() == 3);
+
+    // Wraps around to reuse the slot freed by pop_front
+    buffer.pop_front();
+    buffer.push_back(4);
+    CHECK(buffer.size() == 3);
+    CHECK(buffer.front() == 2);
+    CHECK(buffer.back() == 4);
+    CHECK(buffer[0] == 2);
+    CHECK(buffer[1] == 3);
+    CHECK(buffer[2] == 4);
+}
+
+TEST_CASE("RingBuffer::pop_front()")
+{
+    RingBuffer<int> buffer(2);
+    for (int i = 0; i < 5; ++i) {
+        buffer.push_back(i);
+        CHECK(buffer.front() == i);
+        buffer.pop_front();
+        CHECK(buffer.empty());
+    }
+}
+
+TEMPLATE_TEST_CASE("RollingStatistics::push(FixedPoint)", "", std::int16_t, std::int32_t, std::int64_t)
+{
+    using Fixed = FixedPoint<2, TestType>;
+    constexpr auto statistics
+        = make_aggregate<RollingStatistics<2, TestType>>(Fixed(1, 50), Fixed(2, 25), -Fixed(0, 75));
+    STATIC_CHECK(statistics.size() == 3);
+    STATIC_CHECK(statistics.sum() == decltype(statistics.sum())(3));
+    STATIC_CHECK(statistics.sum_of_squares() == decltype(statistics.sum_of_squares())(7, 8'750));
+}
+
+TEMPLATE_TEST_CASE("RollingStatistics::pop(FixedPoint)", "", std::int16_t, std::int32_t, std::int64_t)
+{
+    using Fixed = FixedPoint<2, TestType>;
+    auto statistics = make_aggregate<RollingStatistics<2, TestType>>(Fixed(1), Fixed(2), Fixed(3));
+    statistics.pop(Fixed(1));
+    CHECK(statistics.size() == 2);
+    CHECK(Fixed(statistics.mean()) == Fixed(2, 50));
+    CHECK(Fixed(statistics.variance()) == Fixed(0, 25));
+}
+
+TEMPLATE_TEST_CASE("RollingStatistics::mean()", "", std::int16_t, std::int32_t, std::int64_t)
+{
+    using Fixed = FixedPoint<2, TestType>;
+    constexpr auto statistics = make_aggregate<RollingStatistics<2, TestType>>(Fixed(1), Fixed(1), Fixed(2));
+    STATIC_CHECK(Fixed(statistics.mean()) == Fixed(1, 33));
+    STATIC_CHECK(Rational<TestType>(statistics.mean()) == Rational<TestType>(4, 3));
+
+    // Truncates toward zero
+    constexpr auto negative = make_aggregate<RollingStatistics<2, TestType>>(-Fixed(0, 50), -Fixed(1, 25));
+    STATIC_CHECK(Fixed(negative.mean()) == -Fixed(0, 87));
+}
+
+TEMPLATE_TEST_CASE("RollingStatistics::variance()", "", std::int16_t, std::int32_t, std::int64_t)
+{
+    using Fixed = FixedPoint<1, TestType>;
+    constexpr auto statistics = make_aggregate<RollingStatistics<1, TestType>>(
+        Fixed(2), Fixed(4), Fixed(4), Fixed(4), Fixed(5), Fixed(5), Fixed(7), Fixed(9));
+    STATIC_CHECK(Fixed(statistics.variance()) == Fixed(4));
+    STATIC_CHECK(Rational<TestType>(statistics.variance()) == Rational<TestType>(4));
+
+    constexpr auto uneven = make_aggregate<RollingStatistics<1, TestType>>(Fixed(1), Fixed(2), Fixed(4));
+    STATIC_CHECK(Fixed(uneven.variance()) == Fixed(1, 5));
+    STATIC_CHECK(Rational<TestType>(uneven.variance()) == Rational<TestType>(14, 9));
+
+    constexpr auto constant = make_aggregate<RollingStatistics<1, TestType>>(Fixed(3, 3), Fixed(3, 3));
+    STATIC_CHECK(Fixed(constant.variance()) == Fixed());
+}
+
+TEMPLATE_TEST_CASE("RollingVwap::push(Trade)", "", std::int16_t, std::int32_t, std::int64_t)
+{
+    using Vwap = RollingVwap<2, 1, TestType>;
+    using Trade = typename Vwap::Trade;
+    constexpr auto vwap = make_aggregate<Vwap>(Trade { FixedPoint<2, TestType>(10), FixedPoint<1, TestType>(1) },
+                                               Trade { FixedPoint<2, TestType>(11), FixedPoint<1, TestType>(2) });
+    STATIC_CHECK(vwap.notional() == decltype(vwap.notional())(32));
+    STATIC_CHECK(vwap.volume() == decltype(vwap.volume())(3));
+    STATIC_CHECK(FixedPoint<2, TestType>(vwap.vwap()) == FixedPoint<2, TestType>(10, 66));
+    STATIC_CHECK(Rational<TestType>(vwap.vwap()) == Rational<TestType>(32, 3));
+}
+
+TEMPLATE_TEST_CASE("RollingVwap::pop(Trade)", "", std::int16_t, std::int32_t, std::int64_t)
+{
+    using Vwap = RollingVwap<2, 1, TestType>;
+    using Trade = typename Vwap::Trade;
+    const Trade first { FixedPoint<2, TestType>(10), FixedPoint<1, TestType>(10) };
+    const Trade second { FixedPoint<2, TestType>(11), FixedPoint<1, TestType>(30) };
+    const Trade third { FixedPoint<2, TestType>(12, 50), FixedPoint<1, TestType>(0, 5) };
+    auto vwap = make_aggregate<Vwap>(first, second, third);
+    vwap.pop(first);
+    CHECK(FixedPoint<2, TestType>(vwap.vwap()) == FixedPoint<2, TestType>(11, 2));
+    vwap.pop(third);
+    CHECK(FixedPoint<2, TestType>(vwap.vwap()) == FixedPoint<2, TestType>(11));
+}
+
+TEST_CASE("SlidingWindow::SlidingWindow(std::size_t)")
+{
+    CHECK(SlidingWindow<RollingStatistics<2>>(4).capacity() == 4);
+    CHECK(SlidingWindow<RollingStatistics<2>>(0).capacity() == 1);
+    CHECK(SlidingWindow<RollingStatistics<2>>(4).empty());
+}
+
+TEMPLATE_TEST_CASE("SlidingWindow::push(value_type)", "", std::int16_t, std::int32_t, std::int64_t)
+{
+    using Fixed = FixedPoint<2, TestType>;
+    SlidingWindow<RollingStatistics<2, TestType>> window(3);
+    for (TestType i = 1; i <= 5; ++i)
+        window.push(Fixed(i));
+    CHECK(window.size() == 3);
+    CHECK(window.values().front() == Fixed(3));
+    CHECK(window.aggregate().size() == 3);
+    CHECK(window.aggregate().sum() == decltype(window.aggregate().sum())(12));
+    CHECK(Fixed(window.aggregate().mean()) == Fixed(4));
+    CHECK(Rational<TestType>(window.aggregate().variance()) == Rational<TestType>(2, 3));
+}
+
+TEMPLATE_TEST_CASE("SlidingWindow::pop()", "", std::int16_t, std::int32_t, std::int64_t)
+{
+    using Vwap = RollingVwap<2, 1, TestType>;
+    SlidingWindow<Vwap> window(2);
+    window.push({ FixedPoint<2, TestType>(10), FixedPoint<1, TestType>(1) });
+    window.push({ FixedPoint<2, TestType>(12), FixedPoint<1, TestType>(1) });
+    window.push({ FixedPoint<2, TestType>(15), FixedPoint<1, TestType>(3) });
+    CHECK(FixedPoint<2, TestType>(window.aggregate().vwap()) == FixedPoint<2, TestType>(14, 25));
+    window.pop();
+    CHECK(window.size() == 1);
+    CHECK(FixedPoint<2, TestType>(window.aggregate().vwap()) == FixedPoint<2, TestType>(15));
+    window.pop();
+    CHECK(window.empty());
+    CHECK(window.aggregate().volume() == decltype(window.aggregate().volume())());
+}